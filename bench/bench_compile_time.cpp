@@ -0,0 +1,209 @@
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2021-2026 niXman (github dot nixman at pm dot me)
+// This file is part of CmdArgs(github.com/niXman/cmdargs) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#   include <spawn.h>
+#   include <sys/resource.h>
+#   include <sys/wait.h>
+extern char **environ;
+#endif
+
+/*************************************************************************************************/
+// the compile-time cost of the library: the front-end (`-fsyntax-only`) time and the peak memory
+// of the compiler for the generated translation units with the growing number of options.
+//
+// usage: bench_compile_time [include-dir]
+//   the `include-dir` is the directory of the `cmdargs/cmdargs.hpp` to measure,
+//   the one of this source tree is used by default.
+
+#ifndef CMDARGS_BENCH_CXX
+#   error "CMDARGS_BENCH_CXX must be defined as the path to the compiler"
+#endif
+#ifndef CMDARGS_BENCH_INCLUDE_DIR
+#   error "CMDARGS_BENCH_INCLUDE_DIR must be defined as the path to the include directory"
+#endif
+
+// the options passed one by one, or the whole `kwords_group`
+enum class e_usage { options, group };
+
+static const char *const option_types[] = {
+     "std::size_t"
+    ,"int"
+    ,"bool"
+    ,"std::string"
+    ,"std::string_view"
+    ,"double"
+    ,"std::vector<int>"
+    ,"std::set<std::string>"
+};
+constexpr std::size_t option_types_num = sizeof(option_types)/sizeof(option_types[0]);
+
+static std::string make_source(std::size_t num, e_usage usage) {
+    std::string res;
+    if ( usage == e_usage::group ) {
+        res += "#define CMDARGS_MAX_OPTIONS_SIZE 32\n";
+    }
+    res += "#include <cmdargs/cmdargs.hpp>\n\n#include <istream>\n\n";
+    res += "struct kwords_type: cmdargs::kwords_group {\n";
+    for ( std::size_t i = 0; i < num; ++i ) {
+        const auto type = option_types[i % option_types_num];
+        const auto idx = std::to_string(i);
+        res += "    CMDARGS_OPTION(opt" + idx + ", " + type + ", \"option " + idx + "\", optional";
+        // every 4th option has the relations with the previous ones
+        if ( i % 4 == 3 ) {
+            res += ", and_(opt" + std::to_string(i - 1) + "), not_(opt" + std::to_string(i - 2) + ")";
+        }
+        if ( i % option_types_num == 0 ) {
+            res += ", default_<std::size_t>(" + idx + ")";
+        }
+        res += ");\n";
+    }
+    res += "};\n\n";
+
+    std::string opts;
+    if ( usage == e_usage::group ) {
+        opts = "kw";
+    } else {
+        for ( std::size_t i = 0; i < num; ++i ) {
+            opts += (i ? ", kw.opt" : "kw.opt") + std::to_string(i);
+        }
+    }
+    res +=
+        "std::size_t parse(const kwords_type &kw, int argc, char **argv, std::istream &is) {\n"
+        "    std::string emsg;\n"
+        "    auto args = cmdargs::parse_args(&emsg, argc, argv, " + opts + ");\n"
+        "    auto cfg = cmdargs::from_file(&emsg, is, " + opts + ");\n"
+        "    return args.get(kw.opt0) + cfg.get(kw.opt0) + emsg.size();\n"
+        "}\n"
+    ;
+
+    return res;
+}
+
+struct compile_stats {
+    bool ok;
+    double seconds;
+    std::size_t peak_rss_kib;
+};
+
+static compile_stats compile(const std::string &fname, const std::string &include_dir) {
+    const std::string include = "-I" + include_dir;
+    std::vector<std::string> args{
+         CMDARGS_BENCH_CXX
+        ,"-std=c++17"
+        ,"-fsyntax-only"
+        ,include
+        ,fname
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+#if defined(__unix__) || defined(__APPLE__)
+    std::vector<char *> argv;
+    for ( auto &it: args ) {
+        argv.push_back(it.data());
+    }
+    argv.push_back(nullptr);
+
+    pid_t pid{};
+    if ( ::posix_spawnp(&pid, argv[0], nullptr, nullptr, argv.data(), environ) != 0 ) {
+        return {false, 0.0, 0};
+    }
+
+    int status{};
+    rusage usage{};
+    if ( ::wait4(pid, &status, 0, &usage) != pid ) {
+        return {false, 0.0, 0};
+    }
+    const bool ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#   if defined(__APPLE__)
+    const auto rss = static_cast<std::size_t>(usage.ru_maxrss) / 1024;
+#   else
+    const auto rss = static_cast<std::size_t>(usage.ru_maxrss);
+#   endif
+#else
+    std::string cmd;
+    for ( const auto &it: args ) {
+        cmd += "\"" + it + "\" ";
+    }
+    const bool ok = std::system(cmd.c_str()) == 0;
+    const std::size_t rss = 0;
+#endif
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return {ok, elapsed.count(), rss};
+}
+
+/*************************************************************************************************/
+
+int main(int argc, char **argv) {
+    const std::string include_dir = (argc > 1) ? argv[1] : CMDARGS_BENCH_INCLUDE_DIR;
+
+    struct bench_case {
+        std::size_t num;
+        e_usage usage;
+    };
+    static const bench_case cases[] = {
+         {8, e_usage::group}
+        ,{16, e_usage::group}
+        ,{32, e_usage::group}
+        ,{8, e_usage::options}
+        ,{16, e_usage::options}
+        ,{32, e_usage::options}
+        ,{64, e_usage::options}
+        ,{128, e_usage::options}
+    };
+
+    bool failed = false;
+    for ( const auto &it: cases ) {
+        const auto name = std::to_string(it.num)
+            + (it.usage == e_usage::group ? " options, group" : " options, one by one");
+        const auto fname = "cmdargs-compile-time-" + std::to_string(it.num)
+            + (it.usage == e_usage::group ? "-group" : "-options") + ".cpp";
+        {
+            std::ofstream os{fname};
+            os << make_source(it.num, it.usage);
+        }
+
+        const auto stats = compile(fname, include_dir);
+        std::remove(fname.c_str());
+
+        char buf[256];
+        std::snprintf(buf, sizeof(buf), "%-32s %8.2f s %10zu KiB peak RSS%s"
+            ,name.c_str(), stats.seconds, stats.peak_rss_kib, stats.ok ? "" : " (FAILED)");
+        std::cout << buf << std::endl;
+
+        failed = failed || !stats.ok;
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,118 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2021-2026 niXman (github dot nixman at pm dot me)
+// This file is part of CmdArgs(github.com/niXman/cmdargs) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <cmdargs/cmdargs.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+/*************************************************************************************************/
+// compares `convert_as_vector<std::uint32_t>` against the previous implementation:
+// `split()` into the `std::vector<std::string_view>` and one `from_chars()` per element
+
+static bool convert_as_vector_split(std::vector<std::uint32_t> &dst, std::string_view str, char sep) {
+    std::vector<std::string_view> vec;
+    cmdargs::details::split(vec, str, sep);
+    for ( const auto &it: vec ) {
+        std::uint32_t v{};
+        cmdargs::details::from_string_impl(&v, it);
+
+        dst.emplace_back(v);
+    }
+
+    return true;
+}
+
+static std::string make_list(std::size_t num, bool hex) {
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::uint32_t> dist{0, 99999999};
+
+    std::string res;
+    for ( std::size_t i = 0; i < num; ++i ) {
+        const auto v = dist(gen);
+        if ( hex ) {
+            char buf[16];
+            std::snprintf(buf, sizeof(buf), "0x%x", v);
+            res += buf;
+        } else {
+            res += std::to_string(v);
+        }
+        res += ',';
+    }
+
+    return res;
+}
+
+template<typename F>
+static double elements_per_second(F &&f, std::string_view str, std::size_t num) {
+    constexpr std::size_t iterations = 20;
+
+    double best = 0.0;
+    std::uint64_t checksum = 0;
+    for ( std::size_t i = 0; i < iterations; ++i ) {
+        std::vector<std::uint32_t> vec;
+        const auto start = std::chrono::steady_clock::now();
+        f(vec, str, ',');
+        const auto stop = std::chrono::steady_clock::now();
+
+        checksum += vec.size() + vec.back();
+        const std::chrono::duration<double> secs = stop - start;
+        best = std::max(best, static_cast<double>(num) / secs.count());
+    }
+    if ( checksum == 0 ) {
+        std::cout << "unexpected checksum" << std::endl;
+    }
+
+    return best;
+}
+
+int main() {
+    constexpr std::size_t num = 200000;
+
+    for ( const bool hex: {false, true} ) {
+        const auto str = make_list(num, hex);
+
+        const auto split = elements_per_second(convert_as_vector_split, str, num);
+        const auto stream = elements_per_second(
+             [](std::vector<std::uint32_t> &dst, std::string_view s, char sep)
+             { return cmdargs::details::convert_as_vector(dst, s, sep); }
+            ,str
+            ,num
+        );
+
+        std::cout
+            << (hex ? "hex    " : "decimal") << ": "
+            << "split+from_chars: " << static_cast<std::uint64_t>(split) << " elem/s, "
+            << "convert_as_vector: " << static_cast<std::uint64_t>(stream) << " elem/s, "
+            << "speedup: " << stream / split
+            << std::endl
+        ;
+    }
+
+    return EXIT_SUCCESS;
+}
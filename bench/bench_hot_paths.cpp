@@ -0,0 +1,507 @@
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2021-2026 niXman (github dot nixman at pm dot me)
+// This file is part of CmdArgs(github.com/niXman/cmdargs) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmdargs/cmdargs.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#   include <sys/resource.h>
+#   include <sys/wait.h>
+#   include <unistd.h>
+#endif
+
+/*************************************************************************************************/
+// the hot paths of the library: `parse_args()`, `from_file()`, `to_file()`, `show_help()`
+// and the construction of the `args_pack`, for the schemas of 8/32/128 options,
+// and the reads of the `atomic` options by `get()` and `get_fast()`.
+//
+// usage: bench_hot_paths [filter]
+//   only the cases which names contain the `filter` are run.
+
+static std::size_t g_allocations = 0;
+
+// the replaced operators are matched, but gcc does not see it after the inlining
+#if defined(__GNUC__) && !defined(__clang__)
+#   pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+    ++g_allocations;
+    if ( void *p = std::malloc(size ? size : 1) ) {
+        return p;
+    }
+
+    throw std::bad_alloc{};
+}
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+void operator delete[](void *p) noexcept {
+    std::free(p);
+}
+void operator delete(void *p, std::size_t) noexcept {
+    operator delete(p);
+}
+void operator delete[](void *p, std::size_t) noexcept {
+    operator delete(p);
+}
+
+// the peak resident set size of the process, in KiB.
+// every case is run in its own forked process, so it's the peak of the case
+static std::size_t peak_rss_kib() {
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage{};
+    if ( ::getrusage(RUSAGE_SELF, &usage) != 0 ) {
+        return 0;
+    }
+#   if defined(__APPLE__)
+    return static_cast<std::size_t>(usage.ru_maxrss) / 1024;
+#   else
+    return static_cast<std::size_t>(usage.ru_maxrss);
+#   endif
+#else
+    return 0;
+#endif
+}
+
+/*************************************************************************************************/
+// the schemas are built from the blocks of 8 options.
+// the `mixed` block covers the predefined converters, the `scalar` one is used for `to_file()`
+// and `show_help()`, since the containers cannot be written into the stream.
+
+using bench_map_type = std::map<std::string, int>;
+
+#define BENCH_MIXED_8(p) \
+    CMDARGS_OPTION(p##_size, std::size_t, "size option", optional, default_<std::size_t>(1)); \
+    CMDARGS_OPTION(p##_int, int, "int option", optional); \
+    CMDARGS_OPTION(p##_bool, bool, "bool option", optional); \
+    CMDARGS_OPTION(p##_str, std::string, "string option", optional); \
+    CMDARGS_OPTION(p##_vec, std::vector<std::uint32_t>, "vector option", optional \
+        ,convert_as_vector<std::uint32_t>()); \
+    CMDARGS_OPTION(p##_list, std::list<int>, "list option", optional \
+        ,convert_as_list<int>()); \
+    CMDARGS_OPTION(p##_set, std::set<std::string>, "set option", optional \
+        ,convert_as_set<std::string>()); \
+    CMDARGS_OPTION(p##_map, bench_map_type, "map option", optional \
+        ,convert_as_map<std::string, int>());
+
+#define BENCH_SCALAR_8(p) \
+    CMDARGS_OPTION(p##_size, std::size_t, "size option", optional, default_<std::size_t>(1)); \
+    CMDARGS_OPTION(p##_int, int, "int option", optional); \
+    CMDARGS_OPTION(p##_bool, bool, "bool option", optional); \
+    CMDARGS_OPTION(p##_str, std::string, "string option", optional); \
+    CMDARGS_OPTION(p##_view, std::string_view, "string_view option", optional); \
+    CMDARGS_OPTION(p##_uint, unsigned, "unsigned option", optional); \
+    CMDARGS_OPTION(p##_double, double, "double option", optional); \
+    CMDARGS_OPTION(p##_float, float, "float option", optional);
+
+#define BENCH_MIXED_REFS_8(k, p) \
+    k.p##_size, k.p##_int, k.p##_bool, k.p##_str, k.p##_vec, k.p##_list, k.p##_set, k.p##_map
+
+#define BENCH_SCALAR_REFS_8(k, p) \
+    k.p##_size, k.p##_int, k.p##_bool, k.p##_str, k.p##_view, k.p##_uint, k.p##_double, k.p##_float
+
+#define BENCH_DECL_32(B, p) B(p##a) B(p##b) B(p##c) B(p##d)
+#define BENCH_DECL_128(B, p) \
+    BENCH_DECL_32(B, p##a) BENCH_DECL_32(B, p##b) BENCH_DECL_32(B, p##c) BENCH_DECL_32(B, p##d)
+
+#define BENCH_REFS_32(R, k, p) R(k, p##a), R(k, p##b), R(k, p##c), R(k, p##d)
+#define BENCH_REFS_128(R, k, p) \
+    BENCH_REFS_32(R, k, p##a), BENCH_REFS_32(R, k, p##b) \
+    ,BENCH_REFS_32(R, k, p##c), BENCH_REFS_32(R, k, p##d)
+
+// the groups of more than `CMDARGS_MAX_OPTIONS_SIZE` options cannot be enumerated,
+// so the options are passed one by one
+#define BENCH_SCHEMA(NAME, DECL, REFS) \
+    struct NAME: cmdargs::kwords_group { \
+        DECL \
+        template<typename F> \
+        decltype(auto) apply(F &&f) const { return f(REFS); } \
+    }
+
+BENCH_SCHEMA(mixed8_type, BENCH_MIXED_8(o), BENCH_MIXED_REFS_8((*this), o));
+BENCH_SCHEMA(mixed32_type
+    ,BENCH_DECL_32(BENCH_MIXED_8, o)
+    ,BENCH_REFS_32(BENCH_MIXED_REFS_8, (*this), o)
+);
+BENCH_SCHEMA(mixed128_type
+    ,BENCH_DECL_128(BENCH_MIXED_8, o)
+    ,BENCH_REFS_128(BENCH_MIXED_REFS_8, (*this), o)
+);
+BENCH_SCHEMA(scalar8_type, BENCH_SCALAR_8(o), BENCH_SCALAR_REFS_8((*this), o));
+BENCH_SCHEMA(scalar32_type
+    ,BENCH_DECL_32(BENCH_SCALAR_8, o)
+    ,BENCH_REFS_32(BENCH_SCALAR_REFS_8, (*this), o)
+);
+BENCH_SCHEMA(scalar128_type
+    ,BENCH_DECL_128(BENCH_SCALAR_8, o)
+    ,BENCH_REFS_128(BENCH_SCALAR_REFS_8, (*this), o)
+);
+
+// the reads of the `atomic` options
+struct atomic_kwords_type: cmdargs::kwords_group {
+    CMDARGS_ATOMIC_OPTION(rate, std::size_t, "rate limit", optional, default_<std::size_t>(100));
+    CMDARGS_ATOMIC_OPTION(ratio, double, "sampling ratio", optional, default_<double>(0.5));
+    CMDARGS_OPTION(name, std::string, "name", optional);
+};
+
+/*************************************************************************************************/
+
+// the `key=value` text for the option, the value depends on the type of the option
+static std::string make_kv(std::string_view name) {
+    const auto suffix = name.substr(name.rfind('_') + 1);
+    std::string res{name};
+    if ( suffix == "size" || suffix == "uint" ) {
+        res += "=4096";
+    } else if ( suffix == "int" ) {
+        res += "=-42";
+    } else if ( suffix == "bool" ) {
+        res += "=true";
+    } else if ( suffix == "str" || suffix == "view" ) {
+        res += "=some string value";
+    } else if ( suffix == "double" || suffix == "float" ) {
+        res += "=3.25";
+    } else if ( suffix == "vec" ) {
+        res += "=1,22,333,4444,55555,666666,7777777,88888888";
+    } else if ( suffix == "list" ) {
+        res += "=-1,2,-3,4,-5,6,-7,8";
+    } else if ( suffix == "set" ) {
+        res += "=alpha,beta,gamma,delta";
+    } else if ( suffix == "map" ) {
+        res += "=a=1,b=2,c=3,d=4";
+    }
+
+    return res;
+}
+
+template<typename KWords>
+static std::vector<std::string> option_names(const KWords &kw) {
+    return kw.apply([](const auto &...opts) { return std::vector<std::string>{std::string{opts.name()}...}; });
+}
+
+// `num` tokens of the command line, cycling over the options
+template<typename KWords>
+static std::vector<std::string> make_tokens(const KWords &kw, std::size_t num) {
+    const auto names = option_names(kw);
+
+    std::vector<std::string> res;
+    res.reserve(num + 1);
+    res.emplace_back("bench");
+    for ( std::size_t i = 0; i < num; ++i ) {
+        res.push_back("--" + make_kv(names[i % names.size()]));
+    }
+
+    return res;
+}
+
+// writes the config file of `lines` lines, cycling over the options, with the comments.
+// the lines are written one by one, so the generation does not affect the peak RSS
+template<typename KWords>
+static void make_config(const std::string &fname, const KWords &kw, std::size_t lines) {
+    const auto names = option_names(kw);
+
+    std::ofstream os{fname, std::ios::binary};
+    for ( std::size_t i = 0; i < lines; ++i ) {
+        if ( i % 8 == 7 ) {
+            os << "# the comment line\n";
+        } else {
+            os << make_kv(names[i % names.size()]) << '\n';
+        }
+    }
+}
+
+/*************************************************************************************************/
+
+static std::string_view g_filter;
+
+static bool selected(const std::string &name) {
+    return name.find(g_filter) != std::string::npos;
+}
+
+// runs the `f` for at least `min_time`, and prints ns/op, allocations/op and the peak RSS
+template<typename F>
+static void measure(const std::string &name, F &&f) {
+    using clock = std::chrono::steady_clock;
+    constexpr auto min_time = std::chrono::milliseconds{200};
+    constexpr std::size_t min_iterations = 3;
+
+    // warm up
+    f();
+
+    std::size_t iterations = 0;
+    const auto allocations = g_allocations;
+    const auto start = clock::now();
+    auto stop = start;
+    do {
+        f();
+        ++iterations;
+        stop = clock::now();
+    } while ( iterations < min_iterations || stop - start < min_time );
+
+    const std::chrono::duration<double, std::nano> elapsed = stop - start;
+    const double ns = elapsed.count() / static_cast<double>(iterations);
+    const double allocs =
+        static_cast<double>(g_allocations - allocations) / static_cast<double>(iterations);
+
+    char buf[256];
+    std::snprintf(buf, sizeof(buf), "%-40s %16.0f ns/op %12.1f allocs/op %10zu KiB peak RSS"
+        ,name.c_str(), ns, allocs, peak_rss_kib());
+    std::cout << buf << std::endl;
+}
+
+// the case is measured in the forked process, so the peak RSS is not the high-water mark
+// left by the previous cases. the peak includes the RSS of the process at the fork.
+template<typename F>
+static void run(const std::string &name, F &&f) {
+    if ( !selected(name) ) {
+        return;
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    std::cout.flush();
+    const pid_t pid = ::fork();
+    if ( pid == 0 ) {
+        measure(name, f);
+        std::cout.flush();
+        ::_exit(EXIT_SUCCESS);
+    }
+    int status = 0;
+    if ( pid == -1 || ::waitpid(pid, &status, 0) != pid
+        || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS )
+    {
+        std::cout << "the case \"" << name << "\" failed" << std::endl;
+
+        std::exit(EXIT_FAILURE);
+    }
+#else
+    measure(name, f);
+#endif
+}
+
+static void check(const std::string &emsg) {
+    if ( !emsg.empty() ) {
+        std::cout << "unexpected error: " << emsg << std::endl;
+
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+/*************************************************************************************************/
+
+template<typename KWords>
+static void bench_construct(const std::string &schema, const KWords &kw) {
+    run(schema + "/args_pack", [&kw] {
+        auto args = kw.apply([](const auto &...opts) { return cmdargs::make_args(opts...); });
+        if ( args.size() == 0 ) {
+            std::cout << "unexpected size" << std::endl;
+        }
+    });
+}
+
+template<typename KWords>
+static void bench_parse_args(const std::string &schema, const KWords &kw) {
+    for ( const std::size_t num: {10u, 100u, 1000u, 10000u} ) {
+        if ( !selected(schema + "/parse_args/" + std::to_string(num))
+            && !selected(schema + "/compiled/" + std::to_string(num)) )
+        {
+            continue;
+        }
+
+        const auto tokens = make_tokens(kw, num);
+        std::vector<char *> argv;
+        for ( const auto &it: tokens ) {
+            argv.push_back(const_cast<char *>(it.c_str()));
+        }
+        const int argc = static_cast<int>(argv.size());
+
+        run(schema + "/parse_args/" + std::to_string(num), [&kw, argc, &argv] {
+            std::string emsg;
+            auto args = kw.apply([&emsg, argc, &argv](const auto &...opts) {
+                return cmdargs::parse_args(&emsg, argc, argv.data(), opts...);
+            });
+            check(emsg);
+        });
+
+        // the pack is built once and refilled in place
+        const auto parser = kw.apply([](const auto &...opts) { return cmdargs::compile(opts...); });
+        auto args = parser.make_pack();
+        run(schema + "/compiled/" + std::to_string(num), [&parser, &args, argc, &argv] {
+            std::string emsg;
+            parser.parse(&emsg, argc, argv.data(), args);
+            check(emsg);
+        });
+    }
+}
+
+template<typename KWords>
+static void bench_from_file(const std::string &schema, const KWords &kw) {
+    for ( const std::size_t lines: {1000u, 10000u, 100000u, 1000000u} ) {
+        if ( !selected(schema + "/from_file/" + std::to_string(lines))
+            && !selected(schema + "/from_mapped_file/" + std::to_string(lines)) )
+        {
+            continue;
+        }
+
+        const auto fname = "cmdargs-bench-" + schema + "-" + std::to_string(lines) + ".cfg";
+        make_config(fname, kw, lines);
+
+        run(schema + "/from_file/" + std::to_string(lines), [&kw, &fname] {
+            std::ifstream is{fname};
+            std::string emsg;
+            auto args = kw.apply([&emsg, &is](const auto &...opts) {
+                return cmdargs::from_file(&emsg, is, opts...);
+            });
+            check(emsg);
+        });
+        run(schema + "/from_mapped_file/" + std::to_string(lines), [&kw, &fname] {
+            std::string emsg;
+            auto args = kw.apply([](const auto &...opts) { return cmdargs::make_args(opts...); });
+            cmdargs::from_mapped_file(&emsg, fname.c_str(), args);
+            check(emsg);
+        });
+
+        std::remove(fname.c_str());
+    }
+}
+
+template<typename KWords>
+static void bench_to_file(const std::string &schema, const KWords &kw) {
+    if ( !selected(schema + "/to_file") ) {
+        return;
+    }
+
+    const auto tokens = make_tokens(kw, option_names(kw).size());
+    std::vector<char *> argv;
+    for ( const auto &it: tokens ) {
+        argv.push_back(const_cast<char *>(it.c_str()));
+    }
+    std::string emsg;
+    const auto args = kw.apply([&emsg, &argv](const auto &...opts) {
+        return cmdargs::parse_args(&emsg, static_cast<int>(argv.size()), argv.data(), opts...);
+    });
+    check(emsg);
+
+    run(schema + "/to_file", [&args] {
+        std::ostringstream os;
+        cmdargs::to_file(os, args);
+    });
+}
+
+template<typename KWords>
+static void bench_show_help(const std::string &schema, const KWords &kw) {
+    const auto args = kw.apply([](const auto &...opts) { return cmdargs::make_args(opts...); });
+
+    run(schema + "/show_help", [&args] {
+        std::ostringstream os;
+        cmdargs::show_help(os, "bench", args);
+    });
+}
+
+// the values are read from many packs, so the reads which chase the pointer out of the pack
+// miss the cache like they do in the program which reads the pack rarely
+static void bench_atomic(const atomic_kwords_type &kw) {
+    for ( const std::size_t num: {1u, 1024u, 65536u} ) {
+        if ( !selected("atomic/get/" + std::to_string(num))
+            && !selected("atomic/get_fast/" + std::to_string(num)) )
+        {
+            continue;
+        }
+
+        using pack_type = decltype(cmdargs::make_args(kw.rate, kw.ratio, kw.name));
+        std::vector<pack_type> packs;
+        packs.reserve(num);
+        for ( std::size_t i = 0; i < num; ++i ) {
+            packs.push_back(cmdargs::make_args(kw.rate = i + 1, kw.ratio, kw.name));
+        }
+
+        run("atomic/get/" + std::to_string(num), [&kw, &packs] {
+            std::size_t sum = 0;
+            for ( const auto &it: packs ) {
+                sum += it.get(kw.rate);
+            }
+            if ( sum == 0 ) {
+                std::cout << "unexpected sum" << std::endl;
+            }
+        });
+        run("atomic/get_fast/" + std::to_string(num), [&kw, &packs] {
+            std::size_t sum = 0;
+            for ( const auto &it: packs ) {
+                sum += it.get_fast(kw.rate);
+            }
+            if ( sum == 0 ) {
+                std::cout << "unexpected sum" << std::endl;
+            }
+        });
+    }
+}
+
+template<typename KWords>
+static void bench_schema(const std::string &schema, const KWords &kw) {
+    bench_construct(schema, kw);
+    bench_parse_args(schema, kw);
+    bench_from_file(schema, kw);
+}
+
+/*************************************************************************************************/
+
+int main(int argc, char **argv) {
+    if ( argc > 1 ) {
+        g_filter = argv[1];
+    }
+
+    static const mixed8_type mixed8;
+    static const mixed32_type mixed32;
+    static const mixed128_type mixed128;
+    static const scalar8_type scalar8;
+    static const scalar32_type scalar32;
+    static const scalar128_type scalar128;
+    static const atomic_kwords_type atomic_kwords;
+
+    bench_schema("mixed8", mixed8);
+    bench_schema("mixed32", mixed32);
+    bench_schema("mixed128", mixed128);
+
+    bench_to_file("scalar8", scalar8);
+    bench_to_file("scalar32", scalar32);
+    bench_to_file("scalar128", scalar128);
+
+    bench_show_help("scalar8", scalar8);
+    bench_show_help("scalar32", scalar32);
+    bench_show_help("scalar128", scalar128);
+
+    bench_atomic(atomic_kwords);
+
+    return EXIT_SUCCESS;
+}
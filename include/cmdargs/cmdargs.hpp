@@ -35,6 +35,7 @@
 #include <map>
 #include <tuple>
 #include <array>
+#include <bitset>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -43,14 +44,75 @@
 #include <utility>
 #include <memory>
 #include <functional>
+#include <limits>
+#include <new>
+#include <mutex>
+#include <atomic>
 
+#include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <cassert>
 
+#if defined(__unix__) || defined(__APPLE__)
+#   define CMDARGS_HAS_MMAP 1
+// the file is opened by `std::fopen()`, because <unistd.h> declares `read()`/`write()`
+// and other common names in the global namespace
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#else
+#   define CMDARGS_HAS_MMAP 0
+#endif
+
+// the environment for the `parse_env()`, <unistd.h> is not included for the same reason
+#if defined(__APPLE__)
+#   include <crt_externs.h>
+#endif
+
+// SSE2 is the baseline of x86-64, so no runtime dispatching is required
+#if !defined(CMDARGS_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#   define CMDARGS_HAS_SSE2 1
+#   include <emmintrin.h>
+#   ifdef _MSC_VER
+#       include <intrin.h>
+#   endif
+#else
+#   define CMDARGS_HAS_SSE2 0
+#endif
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#   define CMDARGS_HAS_EXCEPTIONS 1
+#   define CMDARGS_THROW(e) throw e
+#else
+#   define CMDARGS_HAS_EXCEPTIONS 0
+#   define CMDARGS_THROW(e) std::abort()
+#endif
+
+// the kwords_group with the literal option types and the captureless validators/converters
+// is constant-initialized, `CMDARGS_CONSTINIT` checks it since C++20
+#if defined(__cpp_constinit)
+#   define CMDARGS_CONSTINIT constinit
+#else
+#   define CMDARGS_CONSTINIT
+#endif
+
 #ifndef CMDARGS_MAX_OPTION_DEPS
 #define CMDARGS_MAX_OPTION_DEPS 3
 #endif
 
+// the size of the inline storage for the validators/converters captured state
+#ifndef CMDARGS_CALLABLE_STORAGE_SIZE
+#define CMDARGS_CALLABLE_STORAGE_SIZE (8 * sizeof(void *))
+#endif
+
+// the alignment of the storage of the `atomic` options values
+#ifndef CMDARGS_CACHE_LINE_SIZE
+#define CMDARGS_CACHE_LINE_SIZE 64
+#endif
+
 #define CMDARGS_STRINGIZE_I(x) #x
 #define CMDARGS_STRINGIZE(x) CMDARGS_STRINGIZE_I(x)
 
@@ -203,6 +265,10 @@ constexpr auto type_name() noexcept -> std::string_view {
     return std::string_view{value.data(), value.size()};
 }
 
+// the default-constructed value referenced for the unset options
+template<typename T>
+inline const T empty_value{};
+
 /*************************************************************************************************/
 // to_tuple
 
@@ -241,7 +307,14 @@ struct is_braces_constructible_n
     >
 {};
 
-template<class T, std::size_t L = 0u, std::size_t R = sizeof(T) + 1u>
+// the group has at most `CMDARGS_MAX_OPTIONS_SIZE` options and the base, so the search is
+// limited by it instead of `sizeof(T)` which is much bigger for the groups of the big options.
+// the bigger groups are found as having `CMDARGS_MAX_OPTIONS_SIZE + 1` options and are rejected.
+constexpr std::size_t to_tuple_size_limit(std::size_t size) noexcept {
+    return (size + 1u < CMDARGS_MAX_OPTIONS_SIZE + 3u) ? size + 1u : CMDARGS_MAX_OPTIONS_SIZE + 3u;
+}
+
+template<class T, std::size_t L = 0u, std::size_t R = to_tuple_size_limit(sizeof(T))>
 constexpr std::size_t to_tuple_size_impl() {
     constexpr std::size_t M = (L + R) / 2u;
     if constexpr ( M == 0 ) {
@@ -460,7 +533,10 @@ auto to_tuple_impl(const T &object, std::integral_constant<std::size_t, 32>) noe
 
 template<typename T, std::size_t N>
 auto to_tuple_impl(const T &, std::integral_constant<std::size_t, N>) noexcept {
-    static_assert(N < 33, "Please increase the number of placeholders");
+    static_assert(
+         N <= CMDARGS_MAX_OPTIONS_SIZE && N < 33
+        ,"Please increase CMDARGS_MAX_OPTIONS_SIZE, or pass the options one by one"
+    );
 }
 
 template<
@@ -504,9 +580,72 @@ inline bool split(Sequence<T, A> &result, std::string_view str, char delim) {
     return !result.empty();
 }
 
-inline std::string cat_vector(
+// the number of the fields `split()` produces for the `str`
+inline std::size_t count_fields(std::string_view str, char delim) noexcept {
+    if ( str.empty() ) {
+        return 0;
+    }
+
+    const auto seps = static_cast<std::size_t>(std::count(str.begin(), str.end(), delim));
+
+    return seps + (str.back() != delim ? 1u : 0u);
+}
+
+#if CMDARGS_HAS_SSE2
+inline unsigned count_trailing_zeros(unsigned v) noexcept {
+#   ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanForward(&idx, v);
+    return static_cast<unsigned>(idx);
+#   else
+    return static_cast<unsigned>(__builtin_ctz(v));
+#   endif
+}
+#endif // CMDARGS_HAS_SSE2
+
+// calls `f(field)` for the same fields `split()` produces, without collecting them.
+// with SSE2 the delimiters are found 16 bytes at a time.
+// F -> bool(std::string_view field)
+// F should return TRUE to continue, of FALSE to break.
+template<typename F>
+bool for_each_field(std::string_view str, char delim, F &&f) {
+    const char *field = str.data();
+    const char *ptr = str.data();
+    const char *const end = str.data() + str.size();
+#if CMDARGS_HAS_SSE2
+    const __m128i delims = _mm_set1_epi8(delim);
+    for ( ; end - ptr >= 16; ptr += 16 ) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+        auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, delims)));
+        for ( ; mask; mask &= mask - 1 ) {
+            const char *sep = ptr + count_trailing_zeros(mask);
+            if ( !f(std::string_view{field, static_cast<std::size_t>(sep - field)}) ) {
+                return false;
+            }
+            field = sep + 1;
+        }
+    }
+#endif // CMDARGS_HAS_SSE2
+    for ( ; ptr != end; ++ptr ) {
+        if ( *ptr == delim ) {
+            if ( !f(std::string_view{field, static_cast<std::size_t>(ptr - field)}) ) {
+                return false;
+            }
+            field = ptr + 1;
+        }
+    }
+
+    if ( field != end ) {
+        return f(std::string_view{field, static_cast<std::size_t>(end - field)});
+    }
+
+    return true;
+}
+
+template<typename Names>
+std::string cat_vector(
      const char *pref
-    ,const std::vector<std::string_view> &names
+    ,const Names &names
     ,bool double_quoted = false) noexcept
 {
     std::string res;
@@ -527,8 +666,9 @@ inline std::string cat_vector(
     return res;
 }
 
+// returns false if the `str` can't be converted to the `T`
 template<typename T>
-void from_string_impl(T *val, std::string_view str) {
+bool from_string(T *val, std::string_view str) {
     if constexpr ( std::is_same_v<T, std::string> ) {
         *val = str;
     } else if constexpr ( std::is_same_v<T, std::string_view> ) {
@@ -542,31 +682,368 @@ void from_string_impl(T *val, std::string_view str) {
             str.remove_prefix(2);
         }
         auto [_, ec] = std::from_chars(str.data(), str.data() + str.size(), *val, base);
-        if ( ec != std::errc{} ) {
-            throw invalid_argument(
-                "invalid argument received in cmdargs::details::from_string_impl(), line "
-                CMDARGS_STRINGIZE(__LINE__)
-            );
-        }
+        return ec == std::errc{};
     } else if constexpr ( std::is_floating_point_v<T> ) {
         auto [_, ec] = std::from_chars(str.data(), str.data() + str.size(), *val);
-        if ( ec != std::errc{} ) {
-            throw invalid_argument(
-                "invalid argument received in cmdargs::details::from_string_impl(), line "
-                CMDARGS_STRINGIZE(__LINE__)
-            );
-        }
+        return ec == std::errc{};
     } else if constexpr ( std::is_enum_v<T> ) {
         std::underlying_type_t<T> tmp{};
-        from_string_impl(&tmp, str);
+        if ( !from_string(&tmp, str) ) {
+            return false;
+        }
         *val = static_cast<T>(tmp);
     } else if constexpr ( std::is_pointer_v<T> ) {
         *val = nullptr;
     }
+
+    return true;
+}
+
+template<typename T>
+void from_string_impl(T *val, std::string_view str) {
+    if ( !from_string(val, str) ) {
+        CMDARGS_THROW(invalid_argument(
+            "invalid argument received in cmdargs::details::from_string_impl(), line "
+            CMDARGS_STRINGIZE(__LINE__)
+        ));
+    }
+}
+
+// loads up to 8 chars into the high bytes of the little-endian word, the low bytes are '0'.
+// the fixed-size loads are used, because the `memcpy()` of the variable size is the call.
+inline std::uint64_t load_digits(std::string_view str) noexcept {
+    assert(!str.empty() && str.size() <= 8u);
+
+    const auto size = str.size();
+    std::uint64_t v = 0;
+    if ( size >= 4u ) {
+        // the loads overlap by the same chars
+        std::uint32_t first = 0, last = 0;
+        std::memcpy(&first, str.data(), 4u);
+        std::memcpy(&last, str.data() + size - 4u, 4u);
+        v = first | (static_cast<std::uint64_t>(last) << (8u * (size - 4u)));
+    } else {
+        v = static_cast<std::uint64_t>(static_cast<unsigned char>(str[0]))
+            | (static_cast<std::uint64_t>(static_cast<unsigned char>(str[size / 2u])) << (8u * (size / 2u)))
+            | (static_cast<std::uint64_t>(static_cast<unsigned char>(str[size - 1u])) << (8u * (size - 1u)))
+        ;
+    }
+    const auto shift = 8u * (8u - size);
+
+    return shift ? ((v << shift) | (0x3030303030303030ull >> (64u - shift))) : v;
+}
+
+// converts up to 8 decimal digits at once.
+// returns false if the `str` contains not only the digits.
+inline bool parse_digits_swar(std::uint32_t *val, std::string_view str) noexcept {
+    assert(!str.empty() && str.size() <= 8u);
+
+    std::uint64_t v = load_digits(str);
+    // every byte is in the '0'..'9' range
+    if ( ((v & 0xF0F0F0F0F0F0F0F0ull) | (((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4))
+        != 0x3333333333333333ull )
+    {
+        return false;
+    }
+
+    v -= 0x3030303030303030ull;
+    v = (v * 10u) + (v >> 8u);
+    v = (((v & 0x000000FF000000FFull) * 0x000F424000000064ull)
+        + (((v >> 16u) & 0x000000FF000000FFull) * 0x0000271000000001ull)) >> 32u;
+    *val = static_cast<std::uint32_t>(v);
+
+    return true;
+}
+
+// converts up to 8 hex digits at once, in any case.
+// returns false if the `str` contains not only the hex digits.
+inline bool parse_hex_digits_swar(std::uint32_t *val, std::string_view str) noexcept {
+    assert(!str.empty() && str.size() <= 8u);
+
+    constexpr std::uint64_t high_bits = 0x8080808080808080ull;
+    // the high bit of every byte of the `x` is set if the byte is in the `lo`..`hi` range.
+    // the bytes are less than 0x80, so the sums don't carry into the next byte
+    const auto in_range = [](std::uint64_t x, std::uint8_t lo, std::uint8_t hi) noexcept {
+        const auto ge_lo = x + (0x0101010101010101ull * (0x80u - lo));
+        const auto gt_hi = x + (0x0101010101010101ull * (0x7Fu - hi));
+
+        return ge_lo & ~gt_hi & high_bits;
+    };
+
+    std::uint64_t v = load_digits(str);
+    if ( v & high_bits ) {
+        return false;
+    }
+    const auto digits = in_range(v, '0', '9');
+    const auto letters = in_range(v | 0x2020202020202020ull, 'a', 'f');
+    if ( (digits | letters) != high_bits ) {
+        return false;
+    }
+
+    // the nibbles, the first digit is in the lowest byte
+    v = (v & 0x0F0F0F0F0F0F0F0Full) + (letters >> 7u) * 9u;
+    v = ((v << 4u) + (v >> 8u)) & 0x00FF00FF00FF00FFull;
+    v = ((v << 8u) + (v >> 16u)) & 0x0000FFFF0000FFFFull;
+    *val = static_cast<std::uint32_t>(((v & 0xFFFFu) << 16u) | (v >> 32u));
+
+    return true;
+}
+
+// the same as `from_string()` for the integral types, but the fields of decimal or hex digits
+// short enough to not overflow the `T` are converted eight digits at a time.
+// the others (signed, too long) are passed to `from_string()`.
+template<typename T>
+bool from_string_int(T *val, std::string_view str) {
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>);
+
+    constexpr bool little_endian = CMDARGS_HAS_SSE2 != 0;
+    constexpr std::size_t max_digits = std::numeric_limits<T>::digits10;
+    constexpr std::size_t max_hex_digits = std::numeric_limits<T>::digits / 4;
+    if constexpr ( little_endian && max_hex_digits >= 2u ) {
+        if ( str.size() > 2u && str[0] == '0' && (str[1] == 'x' || str[1] == 'X')
+            && str.size() - 2u <= max_hex_digits )
+        {
+            const auto hex = str.substr(2);
+            std::uint32_t lo = 0;
+            if ( hex.size() <= 8u ) {
+                if ( parse_hex_digits_swar(&lo, hex) ) {
+                    *val = static_cast<T>(lo);
+
+                    return true;
+                }
+            } else {
+                std::uint32_t hi = 0;
+                const auto hi_len = hex.size() - 8u;
+                if ( parse_hex_digits_swar(&hi, hex.substr(0, hi_len))
+                    && parse_hex_digits_swar(&lo, hex.substr(hi_len)) )
+                {
+                    *val = static_cast<T>((static_cast<std::uint64_t>(hi) << 32u) | lo);
+
+                    return true;
+                }
+            }
+        }
+    }
+    if constexpr ( little_endian && max_digits >= 2u ) {
+        if ( !str.empty() && str.size() <= max_digits && str.size() <= 16u ) {
+            std::uint32_t lo = 0;
+            if ( str.size() <= 8u ) {
+                if ( parse_digits_swar(&lo, str) ) {
+                    *val = static_cast<T>(lo);
+
+                    return true;
+                }
+            } else {
+                std::uint32_t hi = 0;
+                const auto hi_len = str.size() - 8u;
+                if ( parse_digits_swar(&hi, str.substr(0, hi_len))
+                    && parse_digits_swar(&lo, str.substr(hi_len)) )
+                {
+                    *val = static_cast<T>(static_cast<std::uint64_t>(hi) * 100000000ull + lo);
+
+                    return true;
+                }
+            }
+        }
+    }
+
+    return from_string(val, str);
+}
+
+// the integral types, but the `bool`
+template<typename T>
+inline constexpr bool is_integer_v = std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+// chooses the converter for the element of the predefined converters
+template<typename T>
+bool from_string_elem(T *val, std::string_view str) {
+    if constexpr ( is_integer_v<T> ) {
+        return from_string_int(val, str);
+    } else {
+        return from_string(val, str);
+    }
+}
+
+/*************************************************************************************************/
+// names table
+// the compile-time perfect hash (hash and displace) used to find the option index by its name
+
+inline constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+constexpr std::uint64_t fnv1a_hash(std::string_view str) noexcept {
+    std::uint64_t h = 0xcbf29ce484222325ull;
+    for ( const char c: str ) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 0x100000001b3ull;
+    }
+
+    return h;
+}
+
+// splitmix64 finalizer
+constexpr std::uint64_t mix_hash(std::uint64_t h) noexcept {
+    h ^= h >> 30; h *= 0xbf58476d1ce4e5b9ull;
+    h ^= h >> 27; h *= 0x94d049bb133111ebull;
+    h ^= h >> 31;
+
+    return h;
+}
+
+constexpr std::size_t pow2_ceil(std::size_t v) noexcept {
+    std::size_t res = 1u;
+    while ( res < v ) {
+        res <<= 1u;
+    }
+
+    return res;
+}
+
+template<std::size_t N>
+struct names_table {
+    static constexpr std::size_t buckets = pow2_ceil(N);
+    static constexpr std::size_t slots   = pow2_ceil(N * 2u);
+
+    std::array<std::uint32_t, buckets> disp{};
+    std::array<std::string_view, slots> names{};
+    std::array<std::size_t, slots> index{};
+
+    static constexpr std::size_t bucket_of(std::uint64_t h) noexcept
+    { return static_cast<std::size_t>(h) & (buckets - 1u); }
+    static constexpr std::size_t slot_of(std::uint64_t h, std::uint32_t d) noexcept
+    { return static_cast<std::size_t>(mix_hash(h + d)) & (slots - 1u); }
+
+    // one probe and one string compare
+    constexpr std::size_t find(std::string_view key) const noexcept {
+        const auto h = fnv1a_hash(key);
+        const auto s = slot_of(h, disp[bucket_of(h)]);
+
+        return (index[s] != npos && names[s] == key) ? index[s] : npos;
+    }
+};
+
+// the names are grouped by the buckets first, so the duplicates are looked for and the
+// displacements are tried only within the bucket, and the construction is about linear
+template<std::size_t N>
+constexpr names_table<N> make_names_table(const std::array<std::string_view, N> &names) {
+    using table_type = names_table<N>;
+    constexpr std::size_t buckets = table_type::buckets;
+
+    table_type res{};
+    for ( auto &it: res.index ) {
+        it = npos;
+    }
+
+    std::array<std::uint64_t, N> hashes{};
+    std::array<std::size_t, buckets + 1u> first{};
+    for ( std::size_t i = 0; i < N; ++i ) {
+        hashes[i] = fnv1a_hash(names[i]);
+        ++first[table_type::bucket_of(hashes[i]) + 1u];
+    }
+    for ( std::size_t b = 0; b < buckets; ++b ) {
+        first[b + 1u] += first[b];
+    }
+
+    // the indexes of the names ordered by the buckets, and by the index within the bucket
+    std::array<std::size_t, N> items{};
+    std::array<std::size_t, buckets> count{};
+    for ( std::size_t i = 0; i < N; ++i ) {
+        const auto b = table_type::bucket_of(hashes[i]);
+        items[first[b] + count[b]++] = i;
+    }
+
+    // for the duplicated names the first one wins
+    std::array<bool, N> skip{};
+    std::size_t max_count = 0;
+    for ( std::size_t b = 0; b < buckets; ++b ) {
+        count[b] = 0;
+        for ( std::size_t k = first[b]; k < first[b + 1u]; ++k ) {
+            for ( std::size_t m = first[b]; m < k && !skip[items[k]]; ++m ) {
+                skip[items[k]] = !skip[items[m]]
+                    && hashes[items[m]] == hashes[items[k]]
+                    && names[items[m]] == names[items[k]]
+                ;
+            }
+            count[b] += !skip[items[k]];
+        }
+        max_count = (count[b] > max_count) ? count[b] : max_count;
+    }
+
+    // the biggest buckets are placed first
+    std::array<bool, table_type::slots> used{};
+    std::array<std::size_t, N> taken{};
+    for ( std::size_t size = max_count; size != 0u; --size ) {
+        for ( std::size_t b = 0; b < buckets; ++b ) {
+            if ( count[b] != size ) {
+                continue;
+            }
+
+            for ( std::uint32_t d = 0; ; ++d ) {
+                std::size_t ntaken = 0;
+                bool ok = true;
+                for ( std::size_t k = first[b]; k < first[b + 1u] && ok; ++k ) {
+                    if ( skip[items[k]] ) {
+                        continue;
+                    }
+                    const auto s = table_type::slot_of(hashes[items[k]], d);
+                    ok = !used[s];
+                    for ( std::size_t j = 0; j < ntaken && ok; ++j ) {
+                        ok = taken[j] != s;
+                    }
+                    taken[ntaken++] = s;
+                }
+                if ( !ok ) {
+                    continue;
+                }
+
+                res.disp[b] = d;
+                for ( std::size_t k = first[b]; k < first[b + 1u]; ++k ) {
+                    if ( skip[items[k]] ) {
+                        continue;
+                    }
+                    const auto s = table_type::slot_of(hashes[items[k]], d);
+                    used[s] = true;
+                    res.names[s] = names[items[k]];
+                    res.index[s] = items[k];
+                }
+
+                break;
+            }
+        }
+    }
+
+    return res;
+}
+
+// how the value found in the key-value list is applied to the option
+enum class e_assign_mode { value, flag, default_value };
+enum class e_assign_status { ok, invalid_value, cant_convert };
+
+// the message for the value rejected by the validator or by the converter
+inline std::string value_error_message(
+     e_assign_status status
+    ,std::string_view pref
+    ,std::string_view name
+    ,std::string_view value)
+{
+    std::string msg;
+    msg += (status == e_assign_status::invalid_value)
+        ? "an invalid value \""
+        : "can't convert value \""
+    ;
+    msg += value;
+    msg += (status == e_assign_status::invalid_value)
+        ? "\" was received for \""
+        : "\" for \""
+    ;
+    msg += pref;
+    msg += name;
+    msg += "\" option";
+
+    return msg;
 }
 
 /*************************************************************************************************/
-// contains and filter
+// contains and duplicates
 
 template<
      template<typename, typename> typename Pred
@@ -586,40 +1063,29 @@ struct contains<Pred, T, std::tuple<Types...>>
     :contains<Pred, T, Types...>
 {};
 
-template<
-     template<typename, typename> typename Pred
-    ,typename Out
-    ,typename In
->
-struct filter;
+// the builtin is not instantiated for every pair of the types, unlike the `std::is_same`
+#if defined(__has_builtin)
+#   if __has_builtin(__is_same)
+#       define CMDARGS_IS_SAME(l, r) __is_same(l, r)
+#   endif
+#endif
+#ifndef CMDARGS_IS_SAME
+#   define CMDARGS_IS_SAME(l, r) std::is_same_v<l, r>
+#endif
 
-template<
-     template<typename, typename> typename Pred
-    ,typename... Out
-    ,typename InCar
-    ,typename... InCdr
->
-struct filter<Pred, std::tuple<Out...>, std::tuple<InCar, InCdr...>> {
-    using type = typename std::conditional_t<
-         contains<Pred, InCar, Out...>::value
-        ,filter<Pred, std::tuple<Out...>, std::tuple<InCdr...>>
-        ,filter<Pred, std::tuple<Out..., InCar>, std::tuple<InCdr...>>
-    >::type;
-};
+template<typename T, typename ...Types>
+constexpr std::size_t count_of() noexcept {
+    return (std::size_t{CMDARGS_IS_SAME(T, Types)} + ... + 0u);
+}
 
-template<
-     template<typename, typename> typename Pred
-    ,typename Out
->
-struct filter<Pred, Out, std::tuple<>> {
-    using type = Out;
-};
+#undef CMDARGS_IS_SAME
 
-template<
-     template<typename, typename> typename Pred
-    ,typename T
->
-using without_duplicates = typename filter<Pred, std::tuple<>, T>::type;
+// the duplicates are looked for by the constant evaluation instead of the recursive filtering
+// of the types list, so the number of the instantiations is linear in the number of the types
+template<typename ...Types>
+constexpr bool has_duplicates() noexcept {
+    return ((count_of<Types, Types...>() > 1u) || ... || false);
+}
 
 /*************************************************************************************************/
 // is callable
@@ -707,6 +1173,140 @@ inline constexpr bool converter_with_deps_invocable_v = std::is_invocable_r_v<
     ,const std::optional<typename std::decay_t<Opts>::value_type>&...
 >;
 
+/*************************************************************************************************/
+// inplace function
+// the non-allocating replacement of `std::function` for the validators/converters:
+// a captureless callable is kept as the function pointer,
+// a callable with the captured state is kept in the inline storage by its concrete type.
+
+template<typename Sig>
+struct inplace_function;
+
+template<typename R, typename ...Args>
+struct inplace_function<R(Args...)> {
+    using pointer_type = R(*)(Args...);
+    static constexpr std::size_t storage_size = CMDARGS_CALLABLE_STORAGE_SIZE;
+
+    constexpr inplace_function() noexcept = default;
+    constexpr inplace_function(pointer_type f) noexcept
+        :m_ptr{f}
+    {}
+    template<
+         typename F
+        ,typename D = std::decay_t<F>
+        ,typename = std::enable_if_t<
+            !std::is_same_v<D, inplace_function>
+            && !std::is_convertible_v<D, pointer_type>
+            && std::is_invocable_r_v<R, D &, Args...>
+        >
+    >
+    inplace_function(F &&f) {
+        static_assert(
+            sizeof(D) <= storage_size && alignof(D) <= alignof(std::max_align_t)
+            ,"cmdargs: the callable is too big (raise CMDARGS_CALLABLE_STORAGE_SIZE)"
+        );
+        ::new(static_cast<void *>(m_buf)) D{std::forward<F>(f)};
+        m_ops = &ops_for<D>;
+    }
+    template<
+         typename F
+        ,typename D = std::decay_t<F>
+        ,typename = std::enable_if_t<
+            !std::is_same_v<D, inplace_function>
+            && std::is_convertible_v<D, pointer_type>
+        >
+        ,typename = void
+    >
+    constexpr inplace_function(F &&f) noexcept
+        :m_ptr{static_cast<pointer_type>(f)}
+    {}
+
+    constexpr inplace_function(const inplace_function &r)
+        :m_ptr{r.m_ptr}
+        ,m_ops{r.m_ops}
+    {
+        if ( m_ops ) {
+            m_ops->copy(m_buf, r.m_buf);
+        }
+    }
+    constexpr inplace_function(inplace_function &&r) noexcept
+        :m_ptr{r.m_ptr}
+        ,m_ops{r.m_ops}
+    {
+        if ( m_ops ) {
+            m_ops->move(m_buf, r.m_buf);
+        }
+    }
+    inplace_function& operator= (const inplace_function &r) {
+        if ( this != &r ) {
+            reset();
+            m_ptr = r.m_ptr;
+            if ( r.m_ops ) {
+                r.m_ops->copy(m_buf, r.m_buf);
+                m_ops = r.m_ops;
+            }
+        }
+
+        return *this;
+    }
+    inplace_function& operator= (inplace_function &&r) noexcept {
+        if ( this != &r ) {
+            reset();
+            m_ptr = r.m_ptr;
+            if ( r.m_ops ) {
+                r.m_ops->move(m_buf, r.m_buf);
+                m_ops = r.m_ops;
+            }
+        }
+
+        return *this;
+    }
+    ~inplace_function() noexcept { reset(); }
+
+    explicit operator bool() const noexcept { return m_ptr || m_ops; }
+
+    R operator() (Args ...args) const {
+        if ( m_ops ) {
+            return m_ops->call(m_buf, std::forward<Args>(args)...);
+        }
+
+        return m_ptr(std::forward<Args>(args)...);
+    }
+
+private:
+    struct ops {
+        R(*call)(void *obj, Args &&...args);
+        void(*copy)(void *dst, const void *src);
+        void(*move)(void *dst, void *src);
+        void(*destroy)(void *obj) noexcept;
+    };
+
+    template<typename D>
+    static constexpr ops ops_for{
+         [](void *obj, Args &&...args) -> R
+         { return (*static_cast<D *>(obj))(std::forward<Args>(args)...); }
+        ,[](void *dst, const void *src)
+         { ::new(dst) D{*static_cast<const D *>(src)}; }
+        ,[](void *dst, void *src)
+         { ::new(dst) D{std::move(*static_cast<D *>(src))}; }
+        ,[](void *obj) noexcept
+         { static_cast<D *>(obj)->~D(); }
+    };
+
+    void reset() noexcept {
+        if ( m_ops ) {
+            m_ops->destroy(m_buf);
+            m_ops = nullptr;
+        }
+        m_ptr = nullptr;
+    }
+
+    pointer_type m_ptr{};
+    const ops *m_ops{};
+    // zeroed for the function pointer to be constant-initialized
+    alignas(std::max_align_t) mutable unsigned char m_buf[storage_size]{};
+};
+
 /*************************************************************************************************/
 // relations
 
@@ -728,15 +1328,44 @@ struct relations_list {
     std::array<std::string_view, sizeof...(Types)> list;
 };
 
-template<e_relation_type E, std::size_t N>
-struct relations_name_list {
-    std::array<std::string_view, N> list;
+// the view of the static array of the relation names
+struct names_span {
+    const std::string_view *ptr;
+    std::size_t len;
+
+    constexpr const std::string_view* begin() const noexcept { return ptr; }
+    constexpr const std::string_view* end() const noexcept { return ptr + len; }
+    constexpr std::size_t size() const noexcept { return len; }
+    constexpr bool empty() const noexcept { return len == 0; }
+    constexpr const std::string_view& operator[] (std::size_t idx) const noexcept { return ptr[idx]; }
 };
 
-// and
-template<typename Unused, typename T>
-struct relation_pred_and: std::false_type
-{};
+// the names of the options of the relation are known at compile time
+template<typename ...Types>
+inline constexpr std::array<std::string_view, sizeof...(Types)> relation_names_v{{
+    std::decay_t<Types>::name()...
+}};
+
+template<typename T>
+struct relation_names;
+
+template<e_relation_type E, typename ...Types>
+struct relation_names<relations_list<E, Types...>> {
+    static constexpr names_span value{
+         relation_names_v<Types...>.data()
+        ,sizeof...(Types)
+    };
+};
+
+template<e_relation_type E, std::size_t N>
+struct relations_name_list {
+    std::array<std::string_view, N> list;
+};
+
+// and
+template<typename Unused, typename T>
+struct relation_pred_and: std::false_type
+{};
 
 template<typename Unused, typename ...Types>
 struct relation_pred_and<Unused, relations_list<e_relation_type::AND, Types...>>
@@ -808,6 +1437,10 @@ struct is_option_ref_for_relation<
 >: std::true_type
 {};
 
+// the type of the option stored in the packs, for the option and for the `option_decl`
+template<typename T>
+using option_of_t = typename std::decay_t<T>::option_type;
+
 template<class T>
 struct type_identity {
     using type = T;
@@ -838,6 +1471,17 @@ template<
 >
 struct get_relation_list<Pred> {};
 
+// the relations of the option resolved to the indexes of the args_pack
+template<std::size_t N>
+struct relation_masks {
+    std::bitset<N> and_mask;
+    std::bitset<N> or_mask;
+    std::bitset<N> not_mask;
+    // the list contains the names of options which are absent in the pack
+    bool and_unresolved{};
+    bool or_nonempty{};
+};
+
 /*************************************************************************************************/
 // default
 
@@ -863,6 +1507,116 @@ struct contains_default
 /*************************************************************************************************/
 
 struct optional_option_t {};
+struct lazy_option_t {};
+
+// the value of the `atomic` option is kept by its bits in the `std::atomic<std::uint64_t>`,
+// so it must be trivially copyable, lock-free and not bigger than 8 bytes
+template<typename T, typename = void>
+struct is_atomic_storable: std::false_type
+{};
+
+template<typename T>
+struct is_atomic_storable<T, std::enable_if_t<std::is_trivially_copyable_v<T>>>
+    :std::bool_constant<
+        std::atomic<T>::is_always_lock_free
+        && std::atomic<std::uint64_t>::is_always_lock_free
+        && sizeof(T) <= sizeof(std::uint64_t)
+    >
+{};
+
+template<typename T>
+constexpr bool is_atomic_storable_v = is_atomic_storable<T>::value;
+
+template<typename T, typename = void>
+struct is_equality_comparable: std::false_type
+{};
+
+template<typename T>
+struct is_equality_comparable<T, std::void_t<decltype(std::declval<const T &>() == std::declval<const T &>())>>
+    :std::true_type
+{};
+
+// can the value refer to the parsed text. the unknown types are considered referring,
+// the arithmetic ones, the enums, and the containers of them are not.
+template<typename T, typename = void>
+struct may_refer_to_text: std::true_type
+{};
+
+template<typename T>
+struct may_refer_to_text<T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>>>
+    :std::false_type
+{};
+
+template<typename T>
+struct may_refer_to_text<T, std::void_t<typename T::value_type, decltype(std::declval<const T &>().begin())>>
+    :may_refer_to_text<typename T::value_type>
+{};
+
+template<>
+struct may_refer_to_text<std::string_view>: std::true_type
+{};
+
+// the value of the `atomic` option on its own cache line,
+// so the readers of the value don't share the line with the writers of anything else.
+// the value is kept by its bits, so the cells of all the value types are the same,
+// and they are stored inline in the args_pack without the tuple of them to instantiate.
+struct alignas(CMDARGS_CACHE_LINE_SIZE) atomic_cell {
+    atomic_cell() noexcept = default;
+    atomic_cell(const atomic_cell &r) noexcept
+        :bits{r.bits.load(std::memory_order_relaxed)}
+    {}
+    atomic_cell& operator= (const atomic_cell &r) noexcept {
+        bits.store(r.bits.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        return *this;
+    }
+
+    template<typename T>
+    T load() const noexcept {
+        const std::uint64_t b = bits.load(std::memory_order_relaxed);
+        T v{};
+        std::memcpy(&v, &b, sizeof(T));
+
+        return v;
+    }
+    template<typename T>
+    void store(const T &v) noexcept {
+        std::uint64_t b{};
+        std::memcpy(&b, &v, sizeof(T));
+        bits.store(b, std::memory_order_relaxed);
+    }
+
+    std::atomic<std::uint64_t> bits{};
+};
+
+// the index of the cell of every option in the args_pack, or `npos` for the option
+// which is not `atomic`
+template<bool ...Atomic>
+constexpr std::array<std::size_t, sizeof...(Atomic)> atomic_cell_indices() noexcept {
+    constexpr bool atomic[] = {Atomic..., false};
+    std::array<std::size_t, sizeof...(Atomic)> res{};
+    std::size_t cell = 0;
+    for ( std::size_t i = 0; i < sizeof...(Atomic); ++i ) {
+        res[i] = atomic[i] ? cell++ : npos;
+    }
+
+    return res;
+}
+
+// the cells of the `atomic` options of the args_pack.
+// the pack without them stores nothing and keeps its alignment,
+// unlike the `std::array<atomic_cell, 0>` of some standard libraries.
+template<std::size_t N>
+struct atomic_cells {
+    atomic_cell& operator[] (std::size_t idx) noexcept { return m_cells[idx]; }
+    const atomic_cell& operator[] (std::size_t idx) const noexcept { return m_cells[idx]; }
+
+private:
+    std::array<atomic_cell, N> m_cells{};
+};
+
+template<>
+struct atomic_cells<0> {};
 
 /*************************************************************************************************/
 
@@ -958,7 +1712,8 @@ inline constexpr std::size_t count_validator_with_deps_v
 
 template<typename Validator, typename... Ts>
 inline constexpr std::size_t count_plain_validators_v
-    = (0u + ... + (std::is_same_v<std::decay_t<Ts>, Validator> ? 1u : 0u));
+    = (0u + ... + (std::is_same_v<std::decay_t<Ts>, Validator>
+        || std::is_same_v<std::decay_t<Ts>, typename Validator::pointer_type> ? 1u : 0u));
 
 template<typename... Ts>
 inline constexpr std::size_t count_converter_with_deps_v
@@ -966,7 +1721,8 @@ inline constexpr std::size_t count_converter_with_deps_v
 
 template<typename Converter, typename... Ts>
 inline constexpr std::size_t count_plain_converters_v
-    = (0u + ... + (std::is_same_v<std::decay_t<Ts>, Converter> ? 1u : 0u));
+    = (0u + ... + (std::is_same_v<std::decay_t<Ts>, Converter>
+        || std::is_same_v<std::decay_t<Ts>, typename Converter::pointer_type> ? 1u : 0u));
 
 /*************************************************************************************************/
 
@@ -977,15 +1733,175 @@ inline constexpr std::size_t count_plain_converters_v
 template<typename ...Args>
 struct args_pack;
 
+template<typename ID, typename V, bool Atomic = false>
+struct option_decl;
+
 #define __CMDARGS__OPTION_SUFFIX _tag
 
+/*************************************************************************************************/
+// text storage
+// the source text kept alive by the args_pack, so `std::string_view` options stay valid
+
+namespace details {
+
+struct text_storage {
+    virtual ~text_storage() = default;
+    virtual std::string_view text() const noexcept = 0;
+};
+
+struct owned_text final: text_storage {
+    explicit owned_text(std::string str) noexcept
+        :m_text{std::move(str)}
+    {}
+
+    std::string_view text() const noexcept override { return m_text; }
+
+private:
+    std::string m_text;
+};
+
+struct mapped_file final: text_storage {
+    mapped_file(const mapped_file &) = delete;
+    mapped_file& operator= (const mapped_file &) = delete;
+
+    explicit mapped_file(const char *fname) {
+#if CMDARGS_HAS_MMAP
+        std::FILE *file = std::fopen(fname, "rb");
+        if ( !file ) {
+            return;
+        }
+        const int fd = ::fileno(file);
+        struct ::stat st{};
+        if ( ::fstat(fd, &st) == 0 ) {
+            m_size = static_cast<std::size_t>(st.st_size);
+            m_is_open = true;
+            if ( m_size ) {
+                void *addr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if ( addr != MAP_FAILED ) {
+                    m_data = static_cast<const char *>(addr);
+                } else {
+                    m_size = 0;
+                    m_is_open = false;
+                }
+            }
+        }
+        std::fclose(file);
+#else
+        // no mmap(): the file is read with one allocation
+        std::FILE *file = std::fopen(fname, "rb");
+        if ( !file ) {
+            return;
+        }
+        if ( std::fseek(file, 0, SEEK_END) == 0 ) {
+            const long size = std::ftell(file);
+            if ( size >= 0 && std::fseek(file, 0, SEEK_SET) == 0 ) {
+                m_buf.resize(static_cast<std::size_t>(size));
+                m_buf.resize(std::fread(m_buf.data(), 1, m_buf.size(), file));
+                m_data = m_buf.data();
+                m_size = m_buf.size();
+                m_is_open = true;
+            }
+        }
+        std::fclose(file);
+#endif
+    }
+    ~mapped_file() {
+#if CMDARGS_HAS_MMAP
+        if ( m_data ) {
+            ::munmap(const_cast<char *>(m_data), m_size);
+        }
+#endif
+    }
+
+    bool is_open() const noexcept { return m_is_open; }
+    std::string_view text() const noexcept override { return {m_data, m_size}; }
+
+private:
+    const char *m_data{};
+    std::size_t m_size{};
+    bool m_is_open{};
+#if !CMDARGS_HAS_MMAP
+    std::string m_buf;
+#endif
+};
+
+// iterates over the lines of the config text skipping the empty lines and comments
+struct config_lines_iterator {
+    config_lines_iterator() noexcept = default;
+    explicit config_lines_iterator(std::string_view text) noexcept
+        :m_rest{text}
+        ,m_line{}
+        ,m_at_end{false}
+    { next(); }
+
+    std::string_view operator* () const noexcept { return m_line; }
+    config_lines_iterator& operator++ () noexcept { next(); return *this; }
+
+    bool operator== (const config_lines_iterator &r) const noexcept {
+        return m_at_end == r.m_at_end && (m_at_end || m_line.data() == r.m_line.data());
+    }
+    bool operator!= (const config_lines_iterator &r) const noexcept { return !(*this == r); }
+
+private:
+    void next() noexcept {
+        static constexpr std::string_view ws{" \t\r"};
+        while ( !m_rest.empty() ) {
+            const auto pos = m_rest.find('\n');
+            const auto line = m_rest.substr(0, pos);
+            m_rest = (pos == std::string_view::npos) ? std::string_view{} : m_rest.substr(pos + 1);
+
+            const auto beg = line.find_first_not_of(ws);
+            if ( beg == std::string_view::npos || line[beg] == '#' ) {
+                continue;
+            }
+            m_line = line.substr(beg, line.find_last_not_of(ws) + 1 - beg);
+
+            return;
+        }
+
+        m_at_end = true;
+    }
+
+    std::string_view m_rest;
+    std::string_view m_line;
+    bool m_at_end = true;
+};
+
+} // ns details
+
 namespace details {
 
+// the type-erased view of the args_pack the dependencies are resolved against
+struct pack_view {
+    const std::type_info * const *types; // the option types
+    const void * const *values;          // the `std::optional<V>` values of the options
+    std::size_t size;
+    bool *found = nullptr;               // the flags of the options found, if not nullptr
+
+    // returns the value of the option of type `O`, or nullptr
+    template<typename O>
+    const std::optional<typename O::value_type>* find() const noexcept {
+        for ( std::size_t idx = 0; idx < size; ++idx ) {
+            if ( *types[idx] == typeid(O) ) {
+                if ( found ) {
+                    found[idx] = true;
+                }
+                return static_cast<const std::optional<typename O::value_type> *>(values[idx]);
+            }
+        }
+
+        return nullptr;
+    }
+};
+
 struct deps_storage_base {
     virtual ~deps_storage_base() = default;
     virtual std::unique_ptr<deps_storage_base> clone() const = 0;
-    virtual const std::type_info &storage_type() const noexcept = 0;
-    virtual void *storage_obj_void() noexcept = 0;
+    // resolves the dependencies against the `pack`
+    virtual bool bind(const pack_view &pack) = 0;
+    // calls the validator/converter with the resolved dependencies
+    virtual bool validate(std::string_view str) const = 0;
+    virtual bool convert(void *dst, std::string_view str) const = 0;
 };
 
 template<typename T>
@@ -1000,15 +1916,36 @@ struct typed_deps_storage final : deps_storage_base {
         return std::make_unique<typed_deps_storage>(T{body});
     }
 
-    const std::type_info &storage_type() const noexcept override {
-        return typeid(T);
+    bool bind(const pack_view &pack) override {
+        return body.bind(pack);
+    }
+
+    bool validate(std::string_view str) const override {
+        if constexpr ( is_validator_with_deps_v<T> ) {
+            return body.call(str);
+        } else {
+            (void)str;
+            assert(false && "cmdargs: not a validator_with_deps");
+
+            return false;
+        }
     }
 
-    void *storage_obj_void() noexcept override {
-        return static_cast<void *>(&body);
+    bool convert(void *dst, std::string_view str) const override {
+        if constexpr ( is_converter_with_deps_v<T> ) {
+            return body.call(*static_cast<typename T::value_type *>(dst), str);
+        } else {
+            (void)dst;
+            (void)str;
+            assert(false && "cmdargs: not a converter_with_deps");
+
+            return false;
+        }
     }
 };
 
+// the entries are never moved between the slots, so the option keeps the index of its slot
+// and the registry work done on the construction of the pack is constant for each option
 struct option_ext_registry {
     struct entry {
         const void *key;
@@ -1017,59 +1954,67 @@ struct option_ext_registry {
     };
 
     std::vector<entry> m_entries;
+    std::vector<std::uint32_t> m_free_slots;
+    std::size_t m_used{};
 
-    void register_at(
+    bool empty() const noexcept { return m_used == 0; }
+
+    std::uint32_t register_at(
          const void *key
         ,std::unique_ptr<deps_storage_base> v
         ,std::unique_ptr<deps_storage_base> c
     ) {
-        if ( !v && !c ) {
-            return;
+        assert(v || c);
+
+        std::uint32_t slot;
+        if ( m_free_slots.empty() ) {
+            slot = static_cast<std::uint32_t>(m_entries.size());
+            m_entries.push_back(entry{key, std::move(v), std::move(c)});
+        } else {
+            slot = m_free_slots.back();
+            m_entries[slot] = entry{key, std::move(v), std::move(c)};
+            m_free_slots.pop_back();
         }
+        ++m_used;
 
-        m_entries.push_back(entry{key, std::move(v), std::move(c)});
+        return slot;
     }
 
-    void unregister_at(const void *key) noexcept {
-        for ( auto it = m_entries.begin(); it != m_entries.end(); ++it ) {
-            if ( it->key == key ) {
-                m_entries.erase(it);
+    void unregister_at(std::uint32_t slot, const void *key) noexcept {
+        assert(slot < m_entries.size() && m_entries[slot].key == key);
+        (void)key;
 
-                return;
-            }
-        }
+        m_entries[slot] = entry{nullptr, nullptr, nullptr};
+        // cannot throw: the capacity of the free list is reserved by `reserve_free_slot()`
+        m_free_slots.push_back(slot);
+        --m_used;
+    }
+
+    // reserves the place in the free list for the slot to be registered,
+    // so `unregister_at()` does not allocate
+    void reserve_free_slot() {
+        m_free_slots.reserve(m_entries.size() + 1);
     }
 
     bool try_clone_for(
-         const void *key
+         std::uint32_t slot
+        ,const void *key
         ,std::unique_ptr<deps_storage_base> *out_v
         ,std::unique_ptr<deps_storage_base> *out_c
     ) const {
-        for ( const auto &e : m_entries ) {
-            if ( e.key != key ) {
-                continue;
-            }
-            if ( e.validator && out_v ) {
-                *out_v = e.validator->clone();
-            }
-            if ( e.converter && out_c ) {
-                *out_c = e.converter->clone();
-            }
-
-            return true;
+        if ( slot >= m_entries.size() || m_entries[slot].key != key ) {
+            return false;
         }
 
-        return false;
-    }
-
-    void retarget_key(const void *old_key, const void *new_key) noexcept {
-        for ( auto &e : m_entries ) {
-            if ( e.key == old_key ) {
-                e.key = new_key;
-
-                return;
-            }
+        const auto &e = m_entries[slot];
+        if ( e.validator && out_v ) {
+            *out_v = e.validator->clone();
+        }
+        if ( e.converter && out_c ) {
+            *out_c = e.converter->clone();
         }
+
+        return true;
     }
 };
 
@@ -1078,7 +2023,13 @@ option_ext_registry *hook_option_ext_for_kwords(
     ,const void *opt_key
     ,std::unique_ptr<deps_storage_base> v
     ,std::unique_ptr<deps_storage_base> c
+    ,std::uint32_t *slot
 );
+void unhook_option_ext_for_kwords(
+     option_ext_registry *reg
+    ,std::uint32_t slot
+    ,const void *opt_key
+) noexcept;
 
 template<typename Tuple, std::size_t N, std::size_t ...I>
 inline void init_pack_dep_arrays_from_registry(
@@ -1091,180 +2042,328 @@ inline void init_pack_dep_arrays_from_registry(
         (void)([&] {
             auto &opt = std::get<I>(tup);
             if ( auto *const reg = opt.deps_registry() ) {
-                const void *const k = static_cast<const void *>(&opt);
-                (void)reg->try_clone_for(k, &va[I], &ca[I]);
+                (void)reg->try_clone_for(opt.deps_slot(), opt.deps_key(), &va[I], &ca[I]);
             }
         }()),
         0
     )...};
 }
 
-template<typename ...P>
-bool rebind_validator_storage_into(
-     deps_storage_base *stor
-    ,std::function<bool(std::string_view)> &slot
-    ,args_pack<P...> &pack
-);
+/*************************************************************************************************/
+// the subscribers for the changes of the options by the `reload()`,
+// keyed by the schema of the option and by the pack they are subscribed to
 
-template<typename V, typename ...P>
-bool rebind_converter_storage_into(
-     deps_storage_base *stor
-    ,std::function<bool(V &, std::string_view)> &slot
-    ,args_pack<P...> &pack
-);
+struct subscribers_registry {
+    using callback_type = std::function<void(const void *value)>;
+
+    static subscribers_registry& instance() noexcept {
+        // never destroyed, because the global subscriptions can be destroyed after it
+        static auto *const registry = new subscribers_registry{};
+
+        return *registry;
+    }
+
+    std::uint64_t add(const void *key, const void *pack, callback_type callback) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        const auto id = ++m_last_id;
+        m_entries.push_back({key, pack, id, std::move(callback)});
+        m_size.store(m_entries.size(), std::memory_order_relaxed);
+
+        return id;
+    }
+    void remove(std::uint64_t id) noexcept {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        const auto it = std::find_if(
+             m_entries.begin()
+            ,m_entries.end()
+            ,[id](const auto &e) { return e.id == id; }
+        );
+        if ( it != m_entries.end() ) {
+            m_entries.erase(it);
+        }
+        m_size.store(m_entries.size(), std::memory_order_relaxed);
+    }
+
+    bool empty() const noexcept { return m_size.load(std::memory_order_relaxed) == 0; }
+
+    // the callbacks are called out of the lock, so they can subscribe and unsubscribe
+    void notify(const void *key, const void *pack, const void *value) const {
+        std::vector<callback_type> callbacks;
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            for ( const auto &it: m_entries ) {
+                if ( it.key == key && it.pack == pack ) {
+                    callbacks.push_back(it.callback);
+                }
+            }
+        }
+        for ( const auto &it: callbacks ) {
+            it(value);
+        }
+    }
+
+private:
+    struct entry {
+        const void *key;
+        const void *pack;
+        std::uint64_t id;
+        callback_type callback;
+    };
+
+    mutable std::mutex m_mutex;
+    std::vector<entry> m_entries;
+    std::uint64_t m_last_id{};
+    std::atomic<std::size_t> m_size{};
+};
+
+} // namespace details
+
+// the subscription for the changes of the option, cancelled on the destruction
+struct subscription {
+    subscription() noexcept = default;
+    explicit subscription(std::uint64_t id) noexcept
+        :m_id{id}
+    {}
+
+    subscription(const subscription &) = delete;
+    subscription& operator= (const subscription &) = delete;
+    subscription(subscription &&r) noexcept
+        :m_id{r.m_id}
+    { r.m_id = 0; }
+    subscription& operator= (subscription &&r) noexcept {
+        if ( this != &r ) {
+            reset();
+            m_id = r.m_id;
+            r.m_id = 0;
+        }
+
+        return *this;
+    }
+    ~subscription() noexcept { reset(); }
+
+    void reset() noexcept {
+        if ( m_id ) {
+            details::subscribers_registry::instance().remove(m_id);
+            m_id = 0;
+        }
+    }
+
+    explicit operator bool() const noexcept { return m_id != 0; }
+
+private:
+    std::uint64_t m_id{};
+};
+
+namespace details {
+
+// the deferred values are converted under the lock, once for the option,
+// so the lock is not contended
+inline std::mutex& lazy_conversion_mutex() noexcept {
+    static std::mutex mutex;
+
+    return mutex;
+}
+
+// the immutable part of the option shared by all the copies of the option
+template<typename V>
+struct option_schema {
+    using validator_type = inplace_function<bool(std::string_view str)>;
+    using converter_type = inplace_function<bool(V &dst, std::string_view str)>;
+
+    // the validator/converter are constructed in place from the function pointer or
+    // from the callable, so the schema of the literal type is constant-initialized
+    template<typename VA, typename CA>
+    constexpr option_schema(
+         std::string_view type_name
+        ,std::string_view description
+        ,bool is_required
+        ,bool is_lazy
+        ,bool uses_custom_validator
+        ,VA &&validator
+        ,bool uses_custom_converter
+        ,CA &&converter
+        ,names_span relation_and
+        ,names_span relation_or
+        ,names_span relation_not
+        ,std::optional<V> default_value
+    )
+        :type_name{type_name}
+        ,description{description}
+        ,is_required{is_required}
+        ,is_lazy{is_lazy}
+        ,uses_custom_validator{uses_custom_validator}
+        ,validator{std::forward<VA>(validator)}
+        ,uses_custom_converter{uses_custom_converter}
+        ,converter{std::forward<CA>(converter)}
+        ,relation_and{relation_and}
+        ,relation_or{relation_or}
+        ,relation_not{relation_not}
+        ,default_value{std::move(default_value)}
+    {}
+
+    std::string_view type_name;
+    std::string_view description;
+    bool is_required;
+    bool is_lazy;
+    bool uses_custom_validator;
+    validator_type validator;
+    bool uses_custom_converter;
+    converter_type converter;
+    names_span relation_and;
+    names_span relation_or;
+    names_span relation_not;
+    std::optional<V> default_value;
+};
+
+// the schema of the `option_decl` is constructed in place, so the group can be constant-initialized.
+// it's copied to the heap by the first copy of the option, and the copy is shared by the reference
+// count between the copies of the option and the `option_decl`, so the copies don't depend
+// on the lifetime of the group.
+template<typename V>
+struct schema_node {
+    template<typename ...Args>
+    constexpr explicit schema_node(std::in_place_t, Args &&...args)
+        :schema{std::forward<Args>(args)...}
+        ,is_decl{true}
+        ,refs{}
+        ,shared{}
+    {}
+    schema_node(const option_schema<V> &schema, std::size_t refs)
+        :schema{schema}
+        ,is_decl{false}
+        ,refs{refs}
+        ,shared{}
+    {}
+
+    option_schema<V> schema;
+    bool is_decl;
+    mutable std::atomic<std::size_t> refs;
+    mutable std::atomic<const schema_node *> shared;
+};
+
+// returns the counted reference to the shared schema
+template<typename V>
+const schema_node<V>* share_schema(const schema_node<V> *node) {
+    if ( node->is_decl ) {
+        const auto *shared = node->shared.load(std::memory_order_acquire);
+        if ( !shared ) {
+            // the second reference is released by the destructor of the `option_decl`
+            const auto *copy = new schema_node<V>{node->schema, 2u};
+            if ( node->shared.compare_exchange_strong(
+                 shared
+                ,copy
+                ,std::memory_order_acq_rel
+                ,std::memory_order_acquire) )
+            {
+                return copy;
+            }
+            delete copy;
+        }
+        node = shared;
+    }
+    node->refs.fetch_add(1u, std::memory_order_relaxed);
+
+    return node;
+}
+
+template<typename V>
+void release_schema(const schema_node<V> *node) noexcept {
+    if ( node && !node->is_decl && node->refs.fetch_sub(1u, std::memory_order_acq_rel) == 1u ) {
+        delete node;
+    }
+}
+
+// the unique address of the option, the key of its dependencies and subscribers
+template<typename ID>
+struct option_key {
+    static constexpr char value{};
+};
 
 } // namespace details
 
-template<typename ID, typename V>
-struct option final {
+// the copies of the option stored in the `args_pack`, in the `live_config` snapshots and
+// in the `compiled_parser` share the schema of the option, see `details::schema_node`.
+// the value of the `Atomic` option is also kept in the cell of the args_pack, see `get_fast()`.
+template<typename ID, typename V, bool Atomic = false>
+struct option {
+    using option_type = option;
     using value_type = V;
     using optional_type  = std::optional<value_type>;
-    using validator_type = std::function<bool(std::string_view str)>;
-    using converter_type = std::function<bool(value_type &dst, std::string_view str)>;
+    using schema_type    = details::option_schema<value_type>;
+    using validator_type = typename schema_type::validator_type;
+    using converter_type = typename schema_type::converter_type;
 
 private:
     template<typename ...Args>
     friend struct args_pack;
-    template<typename... Os>
-    friend struct ::cmdargs::details::validator_with_deps;
-    template<typename Vx, typename... Os>
-    friend struct ::cmdargs::details::converter_with_deps;
-
-    const std::string_view m_type_name;
-    const std::string_view m_description;
-    const bool m_is_required;
-    const bool m_uses_custom_validator;
-    validator_type m_validator;
-    const bool m_uses_custom_converter;
-    converter_type m_converter;
-    const std::vector<std::string_view> m_relation_and;
-    const std::vector<std::string_view> m_relation_or;
-    const std::vector<std::string_view> m_relation_not;
-    const optional_type m_default_value;
-    optional_type m_value;
+    friend struct option_decl<ID, V, Atomic>;
+
+    static_assert(
+         !Atomic || details::is_atomic_storable_v<V>
+        ,"cmdargs: the `atomic` option requires the trivially copyable lock-free value type of up to 8 bytes"
+    );
+
+    using node_type = details::schema_node<value_type>;
+
+    // the schema is shared, so the copies of the option stored in the packs
+    // cost about the size of the values
+    const node_type *m_node;
+    // the value of the lazy option is converted from the deferred text on the first access.
+    // the flag is cleared by the release store after the value is converted,
+    // so the const pack can be read by the threads concurrently, see `materialize()`.
+    mutable optional_type m_value;
+    mutable std::string_view m_deferred;
+    mutable std::atomic<bool> m_is_deferred{};
+    std::uint32_t m_deps_slot{};
     details::option_ext_registry *m_deps_reg{};
 
+    constexpr explicit option(const node_type *node) noexcept
+        :m_node{node}
+        ,m_value{}
+        ,m_deferred{}
+        ,m_is_deferred{}
+        ,m_deps_slot{}
+        ,m_deps_reg{}
+    {}
+
+    const schema_type& schema() const noexcept { return m_node->schema; }
+
 public:
     details::option_ext_registry *deps_registry() const noexcept { return m_deps_reg; }
+    // the index of the dependencies of the option in the registry
+    std::uint32_t deps_slot() const noexcept { return m_deps_slot; }
+    // the key of the dependencies of the option in the registry
+    static constexpr const void* deps_key() noexcept { return &details::option_key<ID>::value; }
 
     option& operator= (const option &) = delete;
     option& operator= (option &&) = delete;
     option(const option &o)
-        :m_type_name{o.m_type_name}
-        ,m_description{o.m_description}
-        ,m_is_required{o.m_is_required}
-        ,m_uses_custom_validator{o.m_uses_custom_validator}
-        ,m_validator{o.m_validator}
-        ,m_uses_custom_converter{o.m_uses_custom_converter}
-        ,m_converter{o.m_converter}
-        ,m_relation_and{o.m_relation_and}
-        ,m_relation_or{o.m_relation_or}
-        ,m_relation_not{o.m_relation_not}
-        ,m_default_value{o.m_default_value}
+        :m_node{details::share_schema(o.m_node)}
         ,m_value{o.m_value}
+        ,m_deferred{o.m_deferred}
+        ,m_is_deferred{o.m_is_deferred.load(std::memory_order_relaxed)}
+        ,m_deps_slot{}
         ,m_deps_reg{}
     {}
 
+    // the moved-from option can only be destroyed
     option(option &&o) noexcept
-        :m_type_name{o.m_type_name}
-        ,m_description{o.m_description}
-        ,m_is_required{o.m_is_required}
-        ,m_uses_custom_validator{o.m_uses_custom_validator}
-        ,m_validator{std::move(o.m_validator)}
-        ,m_uses_custom_converter{o.m_uses_custom_converter}
-        ,m_converter{std::move(o.m_converter)}
-        ,m_relation_and{o.m_relation_and}
-        ,m_relation_or{o.m_relation_or}
-        ,m_relation_not{o.m_relation_not}
-        ,m_default_value{o.m_default_value}
+        :m_node{o.m_node->is_decl ? details::share_schema(o.m_node) : std::exchange(o.m_node, nullptr)}
         ,m_value{std::move(o.m_value)}
+        ,m_deferred{o.m_deferred}
+        ,m_is_deferred{o.m_is_deferred.load(std::memory_order_relaxed)}
+        ,m_deps_slot{o.m_deps_slot}
         ,m_deps_reg{o.m_deps_reg}
     {
-        if ( m_deps_reg ) {
-            m_deps_reg->retarget_key(static_cast<const void *>(&o), static_cast<const void *>(this));
-            o.m_deps_reg = nullptr;
-        }
-    }
-
-    template<typename ...Args>
-    option(kwords_group *owner, const char *descr, std::tuple<Args...> as_tuple)
-        :m_type_name{details::type_name<value_type>()}
-        ,m_description{descr}
-        ,m_is_required{!details::contains<std::is_same, details::optional_option_t, Args...>::value}
-        ,m_uses_custom_validator{
-            has_visitor<validator_type>(as_tuple)
-            || !std::is_same_v<
-                details::tuple_ext_v_t<std::tuple<Args...>>
-                ,details::ext_none
-            >
-        }
-        ,m_validator{init_visitor<validator_type>(as_tuple)}
-        ,m_uses_custom_converter{
-            has_visitor<converter_type>(as_tuple)
-            || !std::is_same_v<
-                details::tuple_ext_c_t<std::tuple<Args...>>
-                ,details::ext_none
-            >
-        }
-        ,m_converter{init_visitor<converter_type>(as_tuple)}
-        ,m_relation_and{init_cond_list<details::e_relation_type::AND>(as_tuple)}
-        ,m_relation_or{init_cond_list<details::e_relation_type::OR>(as_tuple)}
-        ,m_relation_not{init_cond_list<details::e_relation_type::NOT>(as_tuple)}
-        ,m_default_value{get_default_value(as_tuple)}
-        ,m_value{}
-    {
-        using ext_validator_type = details::tuple_ext_v_t<std::tuple<Args...>>;
-        using ext_converter_type = details::tuple_ext_c_t<std::tuple<Args...>>;
-        static_assert(details::count_validator_with_deps_v<Args...> <= 1u);
-        static_assert(details::count_converter_with_deps_v<Args...> <= 1u);
-        static_assert(
-            (details::count_validator_with_deps_v<Args...> == 0u)
-            || (details::count_plain_validators_v<validator_type, Args...> == 0u)
-            ,"cmdargs: option cannot combine validator_ with extra deps and plain validator_"
-        );
-        static_assert(
-            (details::count_converter_with_deps_v<Args...> == 0u)
-            || (details::count_plain_converters_v<converter_type, Args...> == 0u)
-            ,"cmdargs: option cannot combine converter_ with extra deps and plain converter_"
-        );
-
-        std::unique_ptr<details::deps_storage_base> vstor;
-        std::unique_ptr<details::deps_storage_base> cstor;
-
-        if constexpr ( !std::is_same_v<ext_validator_type, details::ext_none> ) {
-            vstor = std::make_unique<details::typed_deps_storage<ext_validator_type>>(
-                std::move(std::get<ext_validator_type>(as_tuple))
-            );
-        }
-        if constexpr ( !std::is_same_v<ext_converter_type, details::ext_none> ) {
-            cstor = std::make_unique<details::typed_deps_storage<ext_converter_type>>(
-                std::move(std::get<ext_converter_type>(as_tuple))
-            );
-        }
-
-        if ( vstor || cstor ) {
-            assert(
-                owner
-                && "cmdargs: options with validator_/converter_ dependencies must be members of kwords_group"
-            );
-            m_deps_reg = details::hook_option_ext_for_kwords(
-                owner
-                ,static_cast<const void *>(this)
-                ,std::move(vstor)
-                ,std::move(cstor)
-            );
-        }
-    }
-    ~option() noexcept {
-        if ( m_deps_reg ) {
-            m_deps_reg->unregister_at(static_cast<const void *>(this));
-        }
+        o.m_deps_reg = nullptr;
     }
+    ~option() noexcept { details::release_schema(m_node); }
 
     template<typename U>
     option operator= (U &&r) const noexcept {
         option res{*this};
         res.m_value = std::forward<U>(r);
+        res.m_is_deferred.store(false, std::memory_order_relaxed);
 
         return res;
     }
@@ -1273,28 +2372,80 @@ public:
         constexpr auto n = details::type_name<ID>();
         return n.substr(0, n.length()-(sizeof(CMDARGS_STRINGIZE(__CMDARGS__OPTION_SUFFIX))-1));
     }
-    std::string_view type_name() const noexcept { return m_type_name; }
-    std::string_view description() const noexcept { return m_description; }
-    bool has_default() const noexcept { return m_default_value.has_value(); }
-    const auto& get_default_value() const noexcept { return m_default_value.value(); }
-    bool is_required() const noexcept { return m_is_required; }
+    std::string_view type_name() const noexcept { return schema().type_name; }
+    std::string_view description() const noexcept { return schema().description; }
+    bool has_default() const noexcept { return schema().default_value.has_value(); }
+    const auto& get_default_value() const noexcept { return schema().default_value.value(); }
+    bool is_required() const noexcept { return schema().is_required; }
     bool is_optional() const noexcept { return !is_required(); }
-    bool is_set() const noexcept { return m_value.has_value(); }
-    const auto& get_value() const noexcept { return m_value.value(); }
-    void set_value(value_type v) { m_value = std::move(v); }
+    bool is_lazy() const noexcept { return schema().is_lazy; }
+    static constexpr bool is_atomic() noexcept { return Atomic; }
+    // the deferred value is checked first, so the value being converted is not read
+    bool is_set() const noexcept { return is_deferred() || m_value.has_value(); }
+    // for the deferred value the conversion error is thrown
+    const auto& get_value() const {
+        materialize_or_throw();
+
+        return m_value.value();
+    }
+    void set_value(value_type v) {
+        m_value = std::move(v);
+        m_is_deferred.store(false, std::memory_order_relaxed);
+    }
+
+    // keeps the text to be validated and converted on the first access to the value.
+    // the text must be alive until then.
+    void defer(std::string_view str) noexcept {
+        m_value.reset();
+        m_deferred = str;
+        m_is_deferred.store(true, std::memory_order_relaxed);
+    }
+    bool is_deferred() const noexcept { return m_is_deferred.load(std::memory_order_acquire); }
+    std::string_view deferred_text() const noexcept { return m_deferred; }
+    // converts the deferred text, if any.
+    // on failure the text stays deferred, so the error is reported on every access.
+    // the const accessors of the shared pack can call it concurrently, so the text is converted
+    // under the lock, once. the lock is not taken for the value which is not deferred.
+    details::e_assign_status materialize() const {
+        if ( !is_deferred() ) {
+            return details::e_assign_status::ok;
+        }
+
+        std::lock_guard<std::mutex> lock{details::lazy_conversion_mutex()};
+        if ( !m_is_deferred.load(std::memory_order_relaxed) ) {
+            return details::e_assign_status::ok;
+        }
+        if ( !validate(m_deferred) ) {
+            return details::e_assign_status::invalid_value;
+        }
+        if ( !convert_to(m_value, m_deferred, nullptr) ) {
+            return details::e_assign_status::cant_convert;
+        }
+        m_is_deferred.store(false, std::memory_order_release);
+
+        return details::e_assign_status::ok;
+    }
     bool is_bool() const noexcept { return std::is_same_v<value_type, bool>; }
 
-    const auto& and_list() const noexcept { return m_relation_and; }
-    const auto& or_list () const noexcept { return m_relation_or;  }
-    const auto& not_list() const noexcept { return m_relation_not; }
+    const auto& and_list() const noexcept { return schema().relation_and; }
+    const auto& or_list () const noexcept { return schema().relation_or;  }
+    const auto& not_list() const noexcept { return schema().relation_not; }
 
-    bool uses_custom_validator() const noexcept { return m_uses_custom_validator; }
-    bool validate(std::string_view str) const noexcept { return m_validator(str); }
-    bool uses_custom_converter() const noexcept { return m_uses_custom_converter; }
-    bool convert(std::string_view str) {
-        value_type v{};
-        if ( m_converter(v, str) ) {
-            m_value = std::move(v);
+    bool uses_custom_validator() const noexcept { return schema().uses_custom_validator; }
+    // `dep` is the validator with the dependencies bound to the pack, if any
+    bool validate(std::string_view str, const details::deps_storage_base *dep = nullptr) const noexcept {
+        if ( dep ) {
+            return dep->validate(str);
+        }
+
+        const auto &validator = schema().validator;
+        return validator ? validator(str) : default_validator(str);
+    }
+    bool uses_custom_converter() const noexcept { return schema().uses_custom_converter; }
+    // `dep` is the converter with the dependencies bound to the pack, if any
+    bool convert(std::string_view str, const details::deps_storage_base *dep = nullptr) {
+        if ( convert_to(m_value, str, dep) ) {
+            m_is_deferred.store(false, std::memory_order_relaxed);
             return true;
         }
         return false;
@@ -1305,17 +2456,17 @@ public:
         const auto flags = os.flags();
         os
             << "name            : " << name() << details::endl
-            << "type            : " << m_type_name << details::endl
-            << "description     : " << '"' << m_description << '"' << details::endl
-            << "is required     : " << (m_is_required ? "true" : "false") << details::endl
+            << "type            : " << type_name() << details::endl
+            << "description     : " << '"' << description() << '"' << details::endl
+            << "is required     : " << (is_required() ? "true" : "false") << details::endl
             << "value           : "
         ;
-        if ( m_value.has_value() ) {
-            os << m_value.value();
+        if ( is_set() ) {
+            os << get_value();
         } else {
-            if ( m_default_value.has_value() ) {
+            if ( has_default() ) {
                 os
-                    << m_default_value.value()
+                    << get_default_value()
                     << " (D)"
                 ;
             } else {
@@ -1326,18 +2477,18 @@ public:
             << details::endl
             << "custom validator: " << (uses_custom_validator() ? "true" : "false") << details::endl
             << "custom converter: " << (uses_custom_converter() ? "true" : "false") << details::endl
-            << "relation     AND: " << m_relation_and.size()
+            << "relation     AND: " << and_list().size()
         ;
-        if ( m_relation_and.size() )
-        { os << " (" << details::cat_vector("--", m_relation_and) << ")" << details::endl; }
+        if ( and_list().size() )
+        { os << " (" << details::cat_vector("--", and_list()) << ")" << details::endl; }
         else { os << details::endl; }
-        os  << "relation      OR: " << m_relation_or.size();
-        if ( m_relation_or.size() )
-        { os << " (" << details::cat_vector("--", m_relation_or) << ")" << details::endl; }
+        os  << "relation      OR: " << or_list().size();
+        if ( or_list().size() )
+        { os << " (" << details::cat_vector("--", or_list()) << ")" << details::endl; }
         else { os << details::endl; }
-        os  << "relation     NOT: " << m_relation_not.size();
-        if ( m_relation_not.size() )
-        { os << " (" << details::cat_vector("--", m_relation_not) << ")" << details::endl; }
+        os  << "relation     NOT: " << not_list().size();
+        if ( not_list().size() )
+        { os << " (" << details::cat_vector("--", not_list()) << ")" << details::endl; }
         else { os << details::endl; }
 
         os.flags(flags);
@@ -1345,94 +2496,212 @@ public:
         return os;
     }
 
-    template<typename ...P>
-    void rebind_to_pack(args_pack<P...> &pack, std::size_t idx) {
-        if ( pack.m_validator_dep[idx] ) {
-            if ( !details::rebind_validator_storage_into<P...>(
-                    pack.m_validator_dep[idx].get()
-                    ,m_validator
-                    ,pack
-                )
-            ) {
-                assert(false && "cmdargs: rebind validator_with_deps failed");
-            }
+private:
+    bool convert_to(optional_type &dst, std::string_view str, const details::deps_storage_base *dep) const {
+        const auto &converter = schema().converter;
+        value_type v{};
+        if ( dep
+            ? dep->convert(&v, str)
+            : converter ? converter(v, str) : default_converter(v, str) )
+        {
+            dst = std::move(v);
+            return true;
         }
-        if ( pack.m_converter_dep[idx] ) {
-            if ( !details::rebind_converter_storage_into<value_type, P...>(
-                    pack.m_converter_dep[idx].get()
-                    ,m_converter
-                    ,pack
-                )
-            ) {
-                assert(false && "cmdargs: rebind converter_with_deps failed");
-            }
+        return false;
+    }
+    void materialize_or_throw() const {
+        const auto status = materialize();
+        if ( status != details::e_assign_status::ok ) {
+            CMDARGS_THROW(invalid_argument(
+                details::value_error_message(status, "--", name(), m_deferred)
+            ));
         }
     }
 
-private:
     static bool default_converter(value_type &dst, std::string_view str) {
-        details::from_string_impl(&dst, str);
-        return true;
+        return details::from_string(&dst, str);
     }
     static bool default_validator(std::string_view /*str*/) {
         return true;
     }
+};
 
-    template<typename Req, typename ...Types>
-    static constexpr bool has_visitor(const std::tuple<Types...> &/*tuple*/) noexcept {
-        return details::contains<std::is_same, Req, Types...>::value;
-    }
-    template<typename Req, typename ...Types>
-    static constexpr typename std::enable_if_t<std::is_same_v<Req, validator_type>, Req>
-    init_visitor(std::tuple<Types...> &tuple) noexcept {
-        if constexpr ( details::contains<std::is_same, Req, Types...>::value ) {
-            return Req{std::move(std::get<Req>(tuple))};
+/*************************************************************************************************/
+
+// the option declared by `CMDARGS_OPTION()` in the `kwords_group`.
+// the copies of the option share the copy of its schema, so they may outlive it.
+// for the literal value type and the captureless validator/converter the constructor is
+// a constant expression, and the group can be constant-initialized.
+template<typename ID, typename V, bool Atomic>
+struct option_decl final: option<ID, V, Atomic> {
+    using base_type      = option<ID, V, Atomic>;
+    using value_type     = typename base_type::value_type;
+    using optional_type  = typename base_type::optional_type;
+    using schema_type    = typename base_type::schema_type;
+    using validator_type = typename base_type::validator_type;
+    using converter_type = typename base_type::converter_type;
+
+    option_decl(const option_decl &) = delete;
+    option_decl& operator= (const option_decl &) = delete;
+
+    template<typename ...Args>
+    constexpr option_decl(kwords_group *owner, const char *descr, std::tuple<Args...> as_tuple)
+        :base_type{&m_decl_node}
+        ,m_decl_node{
+             std::in_place
+            ,details::type_name<value_type>()
+            ,descr
+            ,!details::contains<std::is_same, details::optional_option_t, Args...>::value
+            ,details::contains<std::is_same, details::lazy_option_t, Args...>::value
+            ,has_visitor<validator_type>(as_tuple)
+                || !std::is_same_v<
+                    details::tuple_ext_v_t<std::tuple<Args...>>
+                    ,details::ext_none
+                >
+            ,init_visitor<validator_type>(as_tuple)
+            ,has_visitor<converter_type>(as_tuple)
+                || !std::is_same_v<
+                    details::tuple_ext_c_t<std::tuple<Args...>>
+                    ,details::ext_none
+                >
+            ,init_visitor<converter_type>(as_tuple)
+            ,init_cond_list<details::e_relation_type::AND>(as_tuple)
+            ,init_cond_list<details::e_relation_type::OR>(as_tuple)
+            ,init_cond_list<details::e_relation_type::NOT>(as_tuple)
+            ,init_default_value(as_tuple)
+        }
+    {
+        using ext_validator_type = details::tuple_ext_v_t<std::tuple<Args...>>;
+        using ext_converter_type = details::tuple_ext_c_t<std::tuple<Args...>>;
+        static_assert(details::count_validator_with_deps_v<Args...> <= 1u);
+        static_assert(details::count_converter_with_deps_v<Args...> <= 1u);
+        static_assert(
+            (details::count_validator_with_deps_v<Args...> == 0u)
+            || (details::count_plain_validators_v<validator_type, Args...> == 0u)
+            ,"cmdargs: option cannot combine validator_ with extra deps and plain validator_"
+        );
+        static_assert(
+            (details::count_converter_with_deps_v<Args...> == 0u)
+            || (details::count_plain_converters_v<converter_type, Args...> == 0u)
+            ,"cmdargs: option cannot combine converter_ with extra deps and plain converter_"
+        );
+
+        // only the options with the dependencies do the work at run time
+        if constexpr ( !std::is_same_v<ext_validator_type, details::ext_none>
+            || !std::is_same_v<ext_converter_type, details::ext_none> )
+        {
+            hook_deps(owner, as_tuple);
         } else {
-            return Req{default_validator};
+            (void)owner;
+        }
+    }
+    ~option_decl() noexcept {
+        details::release_schema(m_decl_node.shared.load(std::memory_order_acquire));
+        if ( this->m_deps_reg ) {
+            details::unhook_option_ext_for_kwords(this->m_deps_reg, this->m_deps_slot, this->deps_key());
+        }
+    }
+
+    using base_type::operator=;
+
+    // `f(const std::optional<value_type> &)` is called by the `reload()` of the `args`,
+    // when the value of the option is changed. the value is the default one for the unset option.
+    // the subscription is cancelled when the returned object is destroyed,
+    // and the `args` must not be moved while it is subscribed to.
+    template<typename ...Args, typename F>
+    subscription subscribe(const args_pack<Args...> &args, F &&f) const {
+        return subscription{details::subscribers_registry::instance().add(
+             this->deps_key()
+            ,&args
+            ,[f = std::forward<F>(f)](const void *value) {
+                f(*static_cast<const optional_type *>(value));
+            }
+        )};
+    }
+
+private:
+    template<typename ...Args>
+    void hook_deps(kwords_group *owner, std::tuple<Args...> &as_tuple) {
+        using ext_validator_type = details::tuple_ext_v_t<std::tuple<Args...>>;
+        using ext_converter_type = details::tuple_ext_c_t<std::tuple<Args...>>;
+
+        std::unique_ptr<details::deps_storage_base> vstor;
+        std::unique_ptr<details::deps_storage_base> cstor;
+
+        if constexpr ( !std::is_same_v<ext_validator_type, details::ext_none> ) {
+            vstor = std::make_unique<details::typed_deps_storage<ext_validator_type>>(
+                std::move(std::get<ext_validator_type>(as_tuple))
+            );
         }
+        if constexpr ( !std::is_same_v<ext_converter_type, details::ext_none> ) {
+            cstor = std::make_unique<details::typed_deps_storage<ext_converter_type>>(
+                std::move(std::get<ext_converter_type>(as_tuple))
+            );
+        }
+
+        assert(
+            owner
+            && "cmdargs: options with validator_/converter_ dependencies must be members of kwords_group"
+        );
+        this->m_deps_reg = details::hook_option_ext_for_kwords(
+            owner
+            ,this->deps_key()
+            ,std::move(vstor)
+            ,std::move(cstor)
+            ,&this->m_deps_slot
+        );
+    }
+
+    // the captureless validators/converters are passed as the function pointers,
+    // so the tuple of the arguments is a literal type
+    template<typename Req, typename ...Types>
+    static constexpr bool has_visitor(const std::tuple<Types...> &/*tuple*/) noexcept {
+        return details::contains<std::is_same, Req, Types...>::value
+            || details::contains<std::is_same, typename Req::pointer_type, Types...>::value
+        ;
     }
+    // returns the argument the `Req` is constructed from, the function pointer or the
+    // reference to the stateful callable, so no temporary of the non-literal `Req` is created
     template<typename Req, typename ...Types>
-    static constexpr typename std::enable_if_t<std::is_same_v<Req, converter_type>, Req>
-    init_visitor(std::tuple<Types...> &tuple) noexcept {
+    static constexpr decltype(auto) init_visitor(std::tuple<Types...> &tuple) noexcept {
         if constexpr ( details::contains<std::is_same, Req, Types...>::value ) {
-            return Req{std::move(std::get<Req>(tuple))};
+            return std::move(std::get<Req>(tuple));
+        } else if constexpr ( details::contains<std::is_same, typename Req::pointer_type, Types...>::value ) {
+            return std::get<typename Req::pointer_type>(tuple);
         } else {
-            return Req{default_converter};
+            return typename Req::pointer_type{};
         }
     }
 
     template<details::e_relation_type Rel, typename ...Types>
-    static std::vector<std::string_view>
-    init_cond_list(const std::tuple<Types...> &tuple) noexcept {
+    static constexpr details::names_span
+    init_cond_list(const std::tuple<Types...> &/*tuple*/) noexcept {
         if constexpr ( Rel == details::e_relation_type::AND
             && details::contains_and<Types...>::value )
         {
             using list_type = typename details::get_relation_list<
                 details::relation_pred_and, Types...>::type;
-            const auto &list = std::get<list_type>(tuple).list;
-            if ( list.size() ) return {std::begin(list), std::end(list)};
+            return details::relation_names<list_type>::value;
         }
         if constexpr ( Rel == details::e_relation_type::OR
             && details::contains_or<Types...>::value )
         {
             using list_type = typename details::get_relation_list<
                 details::relation_pred_or, Types...>::type;
-            const auto &list = std::get<list_type>(tuple).list;
-            if ( list.size() ) return {std::begin(list), std::end(list)};
+            return details::relation_names<list_type>::value;
         }
         if constexpr ( Rel == details::e_relation_type::NOT
             && details::contains_not<Types...>::value )
         {
             using list_type = typename details::get_relation_list<
                 details::relation_pred_not, Types...>::type;
-            const auto &list = std::get<list_type>(tuple).list;
-            if ( list.size() ) return {std::begin(list), std::end(list)};
+            return details::relation_names<list_type>::value;
         }
 
-        return {};
+        return {nullptr, 0u};
     }
     template<typename ...Types>
-    static optional_type get_default_value(const std::tuple<Types...> &tuple) noexcept {
+    static constexpr optional_type init_default_value(const std::tuple<Types...> &tuple) noexcept {
         if constexpr ( details::contains_default<Types...>::value ) {
             auto def = std::get<details::default_t<value_type>>(tuple);
             return {std::move(def.val)};
@@ -1440,6 +2709,8 @@ private:
 
         return {};
     }
+
+    typename base_type::node_type m_decl_node;
 };
 
 /*************************************************************************************************/
@@ -1455,6 +2726,14 @@ using version_option_type = option<
      CMDARGS_CAT(struct version, __CMDARGS__OPTION_SUFFIX)
     ,std::string
 >;
+using help_option_decl = option_decl<
+     CMDARGS_CAT(struct help, __CMDARGS__OPTION_SUFFIX)
+    ,bool
+>;
+using version_option_decl = option_decl<
+     CMDARGS_CAT(struct version, __CMDARGS__OPTION_SUFFIX)
+    ,std::string
+>;
 
 } // ns details
 
@@ -1463,22 +2742,32 @@ using version_option_type = option<
 
 namespace details {
 
+// the fields are parsed directly into the destination container in a single pass
+
 template<
      template<typename, typename> class Sequence
     ,typename T
     ,typename A
 >
 bool convert_as_sequence(Sequence<T, A> &dst, std::string_view str, char sep) {
-    std::vector<std::string_view> vec;
-    split(vec, str, sep);
-    for ( const auto &it: vec) {
-        T v{};
-        from_string_impl(&v, it);
-
-        dst.emplace_back(std::move(v));
+    if constexpr ( std::is_same_v<Sequence<T, A>, std::vector<T, A>> ) {
+        dst.reserve(dst.size() + count_fields(str, sep));
     }
 
-    return true;
+    return for_each_field(
+         str
+        ,sep
+        ,[&dst](std::string_view field) {
+            T v{};
+            if ( !from_string_elem(&v, field) ) {
+                return false;
+            }
+
+            dst.emplace_back(std::move(v));
+
+            return true;
+        }
+    );
 }
 
 template<typename T>
@@ -1493,38 +2782,57 @@ bool convert_as_list(std::list<T> &dst, std::string_view str, char sep) {
 
 template<typename K, typename C, typename A>
 bool convert_as_set(std::set<K, C, A> &dst, std::string_view str, char sep) {
-    std::vector<std::string> vec;
-    convert_as_sequence(vec, str, sep);
-    for ( const auto &it: vec ) {
-        K k{};
-        from_string_impl(&k, {it.data(), it.size()});
+    return for_each_field(
+         str
+        ,sep
+        ,[&dst](std::string_view field) {
+            K k{};
+            if ( !from_string_elem(&k, field) ) {
+                return false;
+            }
 
-        dst.emplace(std::move(k));
-    }
+            // the sorted input is inserted in constant time
+            dst.emplace_hint(dst.end(), std::move(k));
 
-    return true;
+            return true;
+        }
+    );
 }
 
 template<typename K, typename V, typename C, typename A>
 bool convert_as_map(std::map<K, V, C, A> &dst, std::string_view str, char pair_sep, char kv_sep) {
-    std::vector<std::string_view> vec;
-    convert_as_sequence(vec, str, pair_sep);
-    for ( const auto &it: vec ) {
-        std::vector<std::string_view> pair;
-        convert_as_sequence(pair, it, kv_sep);
-        if ( pair.size() != 2 )
-            return false;
+    return for_each_field(
+         str
+        ,pair_sep
+        ,[&dst, kv_sep](std::string_view field) {
+            std::array<std::string_view, 2> pair;
+            std::size_t num = 0;
+            for_each_field(
+                 field
+                ,kv_sep
+                ,[&pair, &num](std::string_view it) {
+                    if ( num < pair.size() ) {
+                        pair[num] = it;
+                    }
 
-        K k{};
-        from_string_impl(&k, pair[0]);
+                    return ++num <= pair.size();
+                }
+            );
+            if ( num != 2 ) {
+                return false;
+            }
 
-        V v{};
-        from_string_impl(&v, pair[1]);
+            K k{};
+            V v{};
+            if ( !from_string_elem(&k, pair[0]) || !from_string_elem(&v, pair[1]) ) {
+                return false;
+            }
 
-        dst.emplace(std::move(k), std::move(v));
-    }
+            dst.emplace_hint(dst.end(), std::move(k), std::move(v));
 
-    return true;
+            return true;
+        }
+    );
 }
 
 } // ns details
@@ -1532,35 +2840,42 @@ bool convert_as_map(std::map<K, V, C, A> &dst, std::string_view str, char pair_s
 /*************************************************************************************************/
 
 struct kwords_group {
-    kwords_group() { register_ext_registry(this); }
-    ~kwords_group() { unregister_ext_registry(this); }
+    // the registry for the options with the dependencies is created by the first of them,
+    // so the group itself does no work at run time
+    constexpr kwords_group() noexcept = default;
 
     kwords_group(const kwords_group &) = delete;
     kwords_group &operator=(const kwords_group &) = delete;
 
     static constexpr details::optional_option_t optional{};
+    static constexpr details::lazy_option_t lazy{};
 
     template<typename T>
-    static auto default_(T &&v) noexcept
+    static constexpr auto default_(T &&v) noexcept
     { return details::default_t<T>{std::forward<T>(v)}; }
 
     template<typename ...Types>
-    static auto and_(const Types &...args) noexcept
+    static constexpr auto and_(const Types &...args) noexcept
     { return get_relations<details::e_relation_type::AND>(args...); }
     template<typename ...Types>
-    static auto or_(const Types &...args) noexcept
+    static constexpr auto or_(const Types &...args) noexcept
     { return get_relations<details::e_relation_type::OR>(args...); }
     template<typename ...Types>
-    static auto not_(const Types &...args) noexcept {
+    static constexpr auto not_(const Types &...args) noexcept {
         return get_relations<details::e_relation_type::NOT>(args...);
     }
 
     template<typename F>
-    static auto validator_(F &&f) noexcept {
+    static constexpr auto validator_(F &&f) noexcept {
         static_assert(details::is_callable<F>::value);
         using signature = typename details::callable_traits<F>::signature;
         static_assert(std::is_same_v<signature, bool(const std::string_view str)>);
-        return std::function<signature>{std::forward<F>(f)};
+        using function_type = details::inplace_function<signature>;
+        if constexpr ( std::is_convertible_v<std::decay_t<F>, typename function_type::pointer_type> ) {
+            return static_cast<typename function_type::pointer_type>(f);
+        } else {
+            return function_type{std::forward<F>(f)};
+        }
     }
 
     template<typename F, typename ...Opts>
@@ -1574,18 +2889,23 @@ struct kwords_group {
             details::validator_with_deps_invocable_v<F, Opts...>
             ,"cmdargs: validator with deps must be bool(string_view, const std::optional<T>&...)"
         );
-        return details::validator_with_deps<std::decay_t<Opts>...>{
+        return details::validator_with_deps<details::option_of_t<Opts>...>{
             std::forward<F>(f)
             ,opts...
         };
     }
 
     template<typename F>
-    static auto converter_(F &&f) noexcept {
+    static constexpr auto converter_(F &&f) noexcept {
         static_assert(details::is_callable<F>::value);
         static_assert(details::callable_traits<F>::size == 2);
         using signature = typename details::callable_traits<F>::signature;
-        return std::function<signature>{std::forward<F>(f)};
+        using function_type = details::inplace_function<signature>;
+        if constexpr ( std::is_convertible_v<std::decay_t<F>, typename function_type::pointer_type> ) {
+            return static_cast<typename function_type::pointer_type>(f);
+        } else {
+            return function_type{std::forward<F>(f)};
+        }
     }
 
     template<typename F, typename ...Opts>
@@ -1608,7 +2928,7 @@ struct kwords_group {
                 details::converter_with_deps_invocable_v<F, V, Opts...>
                 ,"cmdargs: converter with deps must be bool(T&, string_view, const std::optional<U>&...)"
             );
-            return details::converter_with_deps<V, std::decay_t<Opts>...>{
+            return details::converter_with_deps<V, details::option_of_t<Opts>...>{
                 std::forward<F>(f)
                 ,opts...
             };
@@ -1631,7 +2951,7 @@ struct kwords_group {
             details::converter_with_deps_invocable_v<F, V, Opts...>
             ,"cmdargs: converter with deps must be bool(T&, string_view, const std::optional<U>&...)"
         );
-        return details::converter_with_deps<V, std::decay_t<Opts>...>{
+        return details::converter_with_deps<V, details::option_of_t<Opts>...>{
             std::forward<F>(f)
             ,opts...
         };
@@ -1672,48 +2992,49 @@ struct kwords_group {
     }
 
 private:
-    static std::vector<
-        std::pair<kwords_group *, std::unique_ptr<details::option_ext_registry>>
-    > &ext_registry_storage() noexcept {
-        thread_local std::vector<
-            std::pair<kwords_group *, std::unique_ptr<details::option_ext_registry>>
-        > storage;
-
-        return storage;
-    }
+    // the registries of all the groups of the process.
+    // only the construction/destruction of the options with the dependencies is synchronized,
+    // the packs use the registry pointer stored in the option.
+    struct ext_registry_storage_type {
+        std::mutex mutex;
+        std::vector<
+            std::pair<const kwords_group *, std::unique_ptr<details::option_ext_registry>>
+        > registries;
+    };
+    static ext_registry_storage_type& ext_registry_storage() noexcept {
+        // never destroyed, because the global groups can be destroyed after it
+        static auto *const storage = new ext_registry_storage_type{};
 
-    static void register_ext_registry(kwords_group *g) {
-        auto &s = ext_registry_storage();
-        assert(
-            std::find_if(
-                 s.begin()
-                ,s.end()
-                ,[g](const auto &p) { return p.first == g; }
-            ) == s.end()
-        );
-        s.emplace_back(g, std::make_unique<details::option_ext_registry>());
+        return *storage;
     }
 
-    static void unregister_ext_registry(kwords_group *g) {
+    // returns the registry of the group, the registry is created for the first option
+    static details::option_ext_registry* acquire_ext_registry(const kwords_group *g) {
         auto &s = ext_registry_storage();
         const auto it = std::find_if(
-             s.begin()
-            ,s.end()
+             s.registries.begin()
+            ,s.registries.end()
             ,[g](const auto &p) { return p.first == g; }
         );
-        assert(it != s.end() && "cmdargs: kwords_group ext registry not registered");
-        s.erase(it);
+        if ( it != s.registries.end() ) {
+            return it->second.get();
+        }
+
+        s.registries.emplace_back(g, std::make_unique<details::option_ext_registry>());
+
+        return s.registries.back().second.get();
     }
 
-    static details::option_ext_registry *lookup_ext_registry(kwords_group *g) noexcept {
+    // the registry is released with the last option registered in it
+    static void release_ext_registry(const details::option_ext_registry *reg) noexcept {
         auto &s = ext_registry_storage();
         const auto it = std::find_if(
-             s.begin()
-            ,s.end()
-            ,[g](const auto &p) { return p.first == g; }
+             s.registries.begin()
+            ,s.registries.end()
+            ,[reg](const auto &p) { return p.second.get() == reg; }
         );
-
-        return it == s.end() ? nullptr : it->second.get();
+        assert(it != s.registries.end() && "cmdargs: kwords_group ext registry not registered");
+        s.registries.erase(it);
     }
 
     friend details::option_ext_registry *details::hook_option_ext_for_kwords(
@@ -1721,18 +3042,22 @@ private:
         ,const void *opt_key
         ,std::unique_ptr<details::deps_storage_base> v
         ,std::unique_ptr<details::deps_storage_base> c
+        ,std::uint32_t *slot
     );
+    friend void details::unhook_option_ext_for_kwords(
+         details::option_ext_registry *reg
+        ,std::uint32_t slot
+        ,const void *opt_key
+    ) noexcept;
 
     template<details::e_relation_type R, typename ...Types>
-    static auto get_relations(const Types &...args) noexcept {
+    static constexpr auto get_relations(const Types &...args) noexcept {
         static_assert(
             (... && details::is_option_ref_for_relation<std::decay_t<Types>>::value)
             ,"cmdargs: and_, or_ and not_ only accept option objects"
         );
-        using tuple_type = std::tuple<typename std::decay_t<Types>...>;
         static_assert(
-            std::tuple_size<tuple_type>::value
-                == std::tuple_size<details::without_duplicates<std::is_same, tuple_type>>::value
+            !details::has_duplicates<details::option_of_t<Types>...>()
             ,"duplicates of keywords is detected!"
         );
         return details::relations_list<R, Types...>{args.name()...};
@@ -1746,41 +3071,142 @@ inline option_ext_registry *hook_option_ext_for_kwords(
     ,const void *opt_key
     ,std::unique_ptr<deps_storage_base> v
     ,std::unique_ptr<deps_storage_base> c
+    ,std::uint32_t *slot
 ) {
-    assert(g && (v || c));
-    auto *const reg = kwords_group::lookup_ext_registry(g);
-    assert(reg && "cmdargs: kwords_group not registered for ext storage");
-    reg->register_at(opt_key, std::move(v), std::move(c));
+    assert(g && (v || c) && slot);
+    std::lock_guard<std::mutex> lock{kwords_group::ext_registry_storage().mutex};
+    // the registry just created is released if the registration throws,
+    // so it's done by the guard and not by the catch, for -fno-exceptions builds
+    struct release_if_empty {
+        option_ext_registry *reg;
+        ~release_if_empty() {
+            if ( reg->empty() ) {
+                kwords_group::release_ext_registry(reg);
+            }
+        }
+    } guard{kwords_group::acquire_ext_registry(g)};
+
+    guard.reg->reserve_free_slot();
+    *slot = guard.reg->register_at(opt_key, std::move(v), std::move(c));
 
-    return reg;
+    return guard.reg;
+}
+
+inline void unhook_option_ext_for_kwords(
+     option_ext_registry *reg
+    ,std::uint32_t slot
+    ,const void *opt_key
+) noexcept {
+    std::lock_guard<std::mutex> lock{kwords_group::ext_registry_storage().mutex};
+    reg->unregister_at(slot, opt_key);
+    if ( reg->empty() ) {
+        kwords_group::release_ext_registry(reg);
+    }
 }
 
 } // namespace details
 
 /*************************************************************************************************/
+// parse result
+// the error is described by the codes only, the message is formatted on demand by
+// `args_pack::error_message()`, so the failed parse does not allocate
+
+enum class e_parse_error {
+     ok
+    ,extra_option   // `text` is the name of the unknown option
+    ,invalid_value  // `text` is the value rejected by the validator
+    ,cant_convert   // `text` is the value rejected by the converter
+    ,no_value       // the option is not the bool one, but no value was provided
+    ,no_required    // the required option was not specified
+    ,cond_and       // the relations of the `option` are broken
+    ,cond_or
+    ,cond_not
+    ,cant_open      // `text` is the name of the file
+};
+
+struct parse_result {
+    e_parse_error error = e_parse_error::ok;
+    // the index of the option in the pack, or `npos`
+    std::size_t option = details::npos;
+    // the position of the token in the parsed range, or `npos`
+    std::size_t token = details::npos;
+    // the view into the parsed input
+    std::string_view text;
+
+    explicit operator bool() const noexcept { return error == e_parse_error::ok; }
+};
+
+/*************************************************************************************************/
+// the variables of the environment for the `parse_env()`
+
+// what is done with the variables with the `prefix` which are not the options
+enum class e_unknown_env {
+     skip   // they are ignored, since the prefix can be shared with the other programs
+    ,reject // they are reported as the extra options
+};
+
+// declared with the default argument before it's the friend of the `args_pack`
+template<typename ...Args>
+parse_result parse_env(
+     std::string_view prefix
+    ,char* const* envp
+    ,args_pack<Args...> &args
+    ,e_unknown_env unknown = e_unknown_env::skip
+);
+
+/*************************************************************************************************/
+// the const members of the pack can be called by the threads concurrently, so the pack can be
+// shared as the `live_config` snapshots are: the deferred values are converted once, under the lock.
+// the non-const members, and the parse into the pack, must not run concurrently with other access.
 
 template<typename ...Args>
 struct args_pack final {
 private:
     using container_type = std::tuple<Args...>;
     static_assert(
-         std::tuple_size<container_type>::value
-            == std::tuple_size<details::without_duplicates<std::is_same, container_type>>::value
+         !details::has_duplicates<Args...>()
         ,"duplicates of keywords are detected!"
     );
 
+    using mask_type = std::bitset<sizeof...(Args)>;
+
     std::array<std::unique_ptr<details::deps_storage_base>, sizeof...(Args)> m_validator_dep{};
     std::array<std::unique_ptr<details::deps_storage_base>, sizeof...(Args)> m_converter_dep{};
 
     container_type m_kwords;
+    // the relations depend only on the pack type, so the packs share them, see `relations_of()`
+    using relations_type = std::array<details::relation_masks<sizeof...(Args)>, sizeof...(Args)>;
+    const relations_type *m_relations;
+    mask_type m_is_set{};
+    bool m_lazy{};
+    // the options the validator_/converter_ dependencies refer to, and the deferred ones of them
+    mask_type m_dep_targets{};
+    mask_type m_deferred_targets{};
+    std::vector<std::unique_ptr<details::text_storage>> m_texts;
+    // the texts of the version before the last `reload()`, see `take_changes()`
+    std::vector<std::unique_ptr<details::text_storage>> m_prev_texts;
+    // the cells of the options declared `atomic`
+    static constexpr auto atomic_cell_index = details::atomic_cell_indices<Args::is_atomic()...>();
+    static constexpr std::size_t atomic_cells_size = (std::size_t{Args::is_atomic()} + ... + 0u);
+    mutable details::atomic_cells<atomic_cells_size> m_atomic_cells{};
+    // the tables of the pack type, built once at compile time
+    static constexpr auto names_table = details::make_names_table<sizeof...(Args)>({{Args::name()...}});
+    static constexpr std::array<bool, sizeof...(Args)> bool_types{{
+        std::is_same_v<typename Args::value_type, bool>...
+    }};
+
+    using deps_array = std::array<std::unique_ptr<details::deps_storage_base>, sizeof...(Args)>;
+
+    static deps_array clone_deps(const deps_array &deps) {
+        deps_array res{};
+        for ( std::size_t i = 0; i < deps.size(); ++i ) {
+            if ( deps[i] ) {
+                res[i] = deps[i]->clone();
+            }
+        }
 
-    template<typename ID, typename V>
-    friend struct option;
-
-    template<typename... Os>
-    friend struct ::cmdargs::details::validator_with_deps;
-    template<typename Vx, typename... Os>
-    friend struct ::cmdargs::details::converter_with_deps;
+        return res;
+    }
 
     template<typename ...Types>
     static container_type init_kwords_and_dep_storage(
@@ -1801,9 +3227,89 @@ private:
         return container_type{std::forward<Types>(types)...};
     }
 
+    // every dependency is looked up by its type in the pack's type table,
+    // so the rebinding is linear in the number of the options.
+    // the options the dependencies refer to are remembered, see `assign()`.
     template<std::size_t ...I>
     void rebind_slots_impl(std::index_sequence<I...>) {
-        (void)(std::get<I>(m_kwords).rebind_to_pack(*this, I), ...);
+        if constexpr ( sizeof...(I) != 0 ) {
+            static const std::type_info *const types[] = {&typeid(Args)...};
+            const void *const values[] = {static_cast<const void *>(&std::get<I>(m_kwords).m_value)...};
+            bool found[sizeof...(I)]{};
+            const details::pack_view view{types, values, sizeof...(I), found};
+
+            for ( auto &dep: m_validator_dep ) {
+                if ( dep && !dep->bind(view) ) {
+                    assert(false && "cmdargs: rebind validator_with_deps failed");
+                }
+            }
+            for ( auto &dep: m_converter_dep ) {
+                if ( dep && !dep->bind(view) ) {
+                    assert(false && "cmdargs: rebind converter_with_deps failed");
+                }
+            }
+            for ( std::size_t i = 0; i < sizeof...(I); ++i ) {
+                m_dep_targets[i] = found[i];
+            }
+        }
+    }
+
+    // the relations are resolved by the first pack of the type
+    static const relations_type* relations_of(const container_type &kwords) {
+        static const relations_type relations = make_relations(kwords);
+
+        return &relations;
+    }
+    static relations_type make_relations(const container_type &kwords) {
+        relations_type res{};
+        std::size_t idx = 0;
+        for_each(
+             kwords
+            ,[&res, &idx](const auto &item) {
+                auto &rel = res[idx++];
+                for ( const auto &it: item.and_list() ) {
+                    const auto i = index_of(it);
+                    if ( i != details::npos ) {
+                        rel.and_mask.set(i);
+                    } else {
+                        rel.and_unresolved = true;
+                    }
+                }
+                for ( const auto &it: item.or_list() ) {
+                    const auto i = index_of(it);
+                    if ( i != details::npos ) {
+                        rel.or_mask.set(i);
+                    }
+                }
+                for ( const auto &it: item.not_list() ) {
+                    const auto i = index_of(it);
+                    if ( i != details::npos ) {
+                        rel.not_mask.set(i);
+                    }
+                }
+                rel.or_nonempty = !item.or_list().empty();
+
+                return true;
+            }
+            ,false
+        );
+
+        return res;
+    }
+
+    void init_is_set() {
+        std::size_t idx = 0;
+        for_each(
+             m_kwords
+            ,[this, &idx](const auto &item) {
+                m_is_set[idx] = item.is_set();
+                store_atomic(idx, item);
+                ++idx;
+
+                return true;
+            }
+            ,false
+        );
     }
 
 public:
@@ -1816,17 +3322,35 @@ public:
             ,m_converter_dep
             ,std::forward<Types>(types)...
         )}
+        ,m_relations{relations_of(m_kwords)}
     {
         constexpr std::size_t n = sizeof...(Args);
         static_assert(sizeof...(Types) == n);
         rebind_slots_impl(std::make_index_sequence<n>{});
+        init_is_set();
+    }
+
+    struct empty_copy_t {};
+
+    // the pack of the same options, with the dependencies rebound to it, and without the values.
+    // it doesn't refer to the `kwords_group`, so the parser and the `live_config` make their packs
+    // by it.
+    args_pack(empty_copy_t, const args_pack &r)
+        :m_validator_dep{clone_deps(r.m_validator_dep)}
+        ,m_converter_dep{clone_deps(r.m_converter_dep)}
+        ,m_kwords{r.m_kwords}
+        ,m_relations{r.m_relations}
+        ,m_lazy{r.m_lazy}
+    {
+        rebind_slots_impl(std::make_index_sequence<sizeof...(Args)>{});
+        reset();
     }
 
     constexpr std::size_t size() const noexcept { return sizeof...(Args); }
 
     template<typename T>
     static constexpr bool contains(const T &) noexcept
-    { return details::contains<std::is_same, T, Args...>::value; }
+    { return details::contains<std::is_same, details::option_of_t<T>, Args...>::value; }
     template<typename T>
     static constexpr bool contains() noexcept
     { return details::contains<std::is_same, T, Args...>::value; }
@@ -1842,10 +3366,13 @@ public:
         return std::nullopt;
     }
 
-    auto optionals() const noexcept {
+    auto optionals() const {
+        materialize_or_throw();
+
         return std::make_tuple(std::get<Args>(m_kwords).m_value...);
     }
     auto values() const {
+        materialize_or_throw();
         auto res = std::make_tuple(
             (std::get<Args>(m_kwords).m_value.has_value()
                 ? std::get<Args>(m_kwords).m_value.value()
@@ -1854,6 +3381,35 @@ public:
         return res;
     }
 
+    // the same as `optionals()`/`values()`, but the values are moved out of the pack
+    auto take_optionals() && {
+        materialize_or_throw();
+
+        return std::make_tuple(std::move(std::get<Args>(m_kwords).m_value)...);
+    }
+    auto take_values() && {
+        materialize_or_throw();
+        auto res = std::make_tuple(
+            (std::get<Args>(m_kwords).m_value.has_value()
+                ? std::move(std::get<Args>(m_kwords).m_value.value())
+                : typename Args::value_type{})...
+        );
+        return res;
+    }
+
+    // the same as `values()`, but the tuple of const references to the values of the pack.
+    // for the unset options the references to the default-constructed values are returned.
+    auto value_refs() const & {
+        materialize_or_throw();
+
+        return std::tuple<const typename Args::value_type &...>{
+            (std::get<Args>(m_kwords).m_value.has_value()
+                ? std::get<Args>(m_kwords).m_value.value()
+                : details::empty_value<typename Args::value_type>)...
+        };
+    }
+    void value_refs() const && = delete;
+
     template<typename T>
     bool is_set() const {
         static_assert(contains<T>(), "");
@@ -1863,33 +3419,21 @@ public:
 
     template<typename T>
     bool is_set(const T &) const {
-        static_assert(contains<T>(), "");
-
-        return std::get<T>(m_kwords).is_set();
+        return is_set<details::option_of_t<T>>();
     }
 
     template<typename T>
     bool has_default(const T &) const {
-        static_assert(contains<T>(), "");
+        using option_type = details::option_of_t<T>;
+        static_assert(contains<option_type>(), "");
 
-        return std::get<T>(m_kwords).has_default();
+        return std::get<option_type>(m_kwords).has_default();
     }
 
     bool is_bool_type(const std::string_view name) const {
-        bool res{};
+        const auto idx = index_of(name);
 
-        for_each(
-            [&res, &name](const auto &item) {
-                if ( item.name() == name ) {
-                    res = item.is_bool();
-                    return false;
-                }
-                return true;
-            }
-            ,false
-        );
-
-        return res;
+        return idx != details::npos && is_bool_type(idx);
     }
 
     template<typename T>
@@ -1904,20 +3448,13 @@ public:
         return val.get_default_value();
     }
     template<typename T>
-    const auto& get(const T &k) const {
-        static_assert(contains<T>(), "");
-
-        const auto &val = std::get<T>(m_kwords);
-        if ( is_set(k) ) {
-            return val.get_value();
-        }
-
-        return val.get_default_value();
+    const auto& get(const T &) const {
+        return get<details::option_of_t<T>>();
     }
     template<typename T, typename Default>
     typename T::value_type get(const T &k, Default &&def) const {
         if ( is_set(k) ) {
-            return std::get<T>(m_kwords).get_value();
+            return std::get<details::option_of_t<T>>(m_kwords).get_value();
         }
 
         return std::forward<Default>(def);
@@ -1926,6 +3463,110 @@ public:
     template<typename T>
     const auto& operator[] (const T &k) const { return get(k); }
 
+    // the value of the option declared `atomic`, by the single relaxed load.
+    // it's the parsed value, or the default one, until the `store()`.
+    template<typename T>
+    auto get_fast(const T &) const noexcept {
+        using option_type = details::option_of_t<T>;
+        static_assert(contains<option_type>(), "");
+        static_assert(option_type::is_atomic(), "cmdargs: get_fast() requires the `atomic` option");
+
+        constexpr auto idx = index_of(option_type::name());
+
+        return m_atomic_cells[atomic_cell_index[idx]].template load<typename option_type::value_type>();
+    }
+
+    // validates and converts the `str` by the validator/converter of the option declared `atomic`,
+    // and stores the value for the `get_fast()`. may be called concurrently with the `get_fast()`.
+    // the `get()` keeps returning the parsed value.
+    template<typename T>
+    parse_result store(const T &, std::string_view str) const {
+        using option_type = details::option_of_t<T>;
+        static_assert(contains<option_type>(), "");
+        static_assert(option_type::is_atomic(), "cmdargs: store() requires the `atomic` option");
+
+        constexpr auto idx = index_of(option_type::name());
+
+        const auto &item = std::get<option_type>(m_kwords);
+        if ( !item.validate(str, m_validator_dep[idx].get()) ) {
+            return {e_parse_error::invalid_value, idx, details::npos, str};
+        }
+        typename option_type::optional_type v;
+        if ( !item.convert_to(v, str, m_converter_dep[idx].get()) ) {
+            return {e_parse_error::cant_convert, idx, details::npos, str};
+        }
+        m_atomic_cells[atomic_cell_index[idx]].store(*v);
+
+        return {};
+    }
+
+    // when the pack is lazy, the values of all the options are kept as the texts by the parse,
+    // and are validated and converted on the first access, as for the options declared `lazy`.
+    // the options with validator_/converter_ dependencies are always converted by the parse.
+    void set_lazy(bool lazy) noexcept { m_lazy = lazy; }
+    bool is_lazy() const noexcept { return m_lazy; }
+
+    // the number of the source texts kept alive by the pack,
+    // of the current version and of the one before the last `reload()`
+    std::size_t kept_texts() const noexcept { return m_texts.size() + m_prev_texts.size(); }
+
+    // validates and converts all the deferred values.
+    // returns the error for the first option which can't be converted.
+    parse_result materialize_all() const {
+        parse_result res;
+        std::size_t idx = 0;
+        for_each(
+             m_kwords
+            ,[&res, &idx](const auto &item) {
+                const auto status = item.materialize();
+                if ( status != details::e_assign_status::ok ) {
+                    res = {
+                         (status == details::e_assign_status::invalid_value)
+                            ? e_parse_error::invalid_value
+                            : e_parse_error::cant_convert
+                        ,idx
+                        ,details::npos
+                        ,item.deferred_text()
+                    };
+                }
+                ++idx;
+
+                return bool(res);
+            }
+            ,false
+        );
+
+        return res;
+    }
+
+    // moves the text into the pack and returns the view of it.
+    // the view, and the `std::string_view` options parsed from it, are valid until the pack is destroyed.
+    std::string_view keep_text(std::string text) {
+        return keep_text(std::make_unique<details::owned_text>(std::move(text)));
+    }
+
+    // makes all the options unset for the pack to be reused for the next parse.
+    // the rebound validators/converters, the dependency storage and the relations are kept,
+    // the texts kept by the pack are released.
+    void reset() noexcept {
+        std::size_t idx = 0;
+        for_each(
+             m_kwords
+            ,[this, &idx](auto &item) {
+                item.m_value.reset();
+                item.m_is_deferred.store(false, std::memory_order_relaxed);
+                store_atomic(idx++, item);
+
+                return true;
+            }
+            ,false
+        );
+        m_is_set.reset();
+        m_deferred_targets.reset();
+        m_texts.clear();
+        m_prev_texts.clear();
+    }
+
     const auto& operator() () const { return m_kwords; }
 
     template<typename OS>
@@ -1957,58 +3598,337 @@ public:
         for_each(m_kwords, std::forward<F>(f), inited_only);
     }
 
+    // formats the message for the failed parse.
+    // the `res` must be received for this pack, and the parsed input must be alive.
+    std::string error_message(const parse_result &res, const char *pref = "--") const {
+        const std::string_view pr{pref ? pref : ""};
+        const std::string_view name = (res.option != details::npos)
+            ? name_at(res.option)
+            : std::string_view{}
+        ;
+
+        std::string msg;
+        switch ( res.error ) {
+            case e_parse_error::ok: break;
+            case e_parse_error::extra_option: {
+                msg += "there is an extra \"";
+                msg += pr;
+                msg += res.text;
+                msg += "\" option was specified";
+            } break;
+            case e_parse_error::invalid_value: {
+                msg = details::value_error_message(
+                    details::e_assign_status::invalid_value, pr, name, res.text
+                );
+            } break;
+            case e_parse_error::cant_convert: {
+                msg = details::value_error_message(
+                    details::e_assign_status::cant_convert, pr, name, res.text
+                );
+            } break;
+            case e_parse_error::no_value: {
+                msg += "a value must be provided for \"";
+                msg += pr;
+                msg += name;
+                msg += "\" option";
+            } break;
+            case e_parse_error::no_required: {
+                msg += "no required \"";
+                msg += pr;
+                msg += name;
+                msg += "\" option was specified";
+            } break;
+            case e_parse_error::cond_and: {
+                msg += "the \"";
+                msg += pr;
+                msg += name;
+                msg += "\" option must be used together with \"";
+                msg += details::cat_vector(pref, cond_names(res.error, res.option));
+                msg += "\"";
+            } break;
+            case e_parse_error::cond_or:
+            case e_parse_error::cond_not: {
+                const auto names = cond_names(res.error, res.option);
+                msg += "the \"";
+                msg += pr;
+                msg += name;
+                msg += (res.error == e_parse_error::cond_or)
+                    ? "\" option must be used together with "
+                    : "\" option can't be used together with "
+                ;
+                if ( names.size() > 1 ) {
+                    msg += "one of ";
+                }
+                msg += details::cat_vector(pref, names, true);
+            } break;
+            case e_parse_error::cant_open: {
+                msg += "can't open \"";
+                msg += res.text;
+                msg += "\" file";
+            } break;
+        }
+
+        return msg;
+    }
+
 private:
     template<typename Iter, typename ...TArgs>
-    friend void parse_kv_list(
-         std::string *emsg
-        ,const char *pref
+    friend parse_result parse_kv_list(
+         const char *pref
         ,std::size_t pref_len
         ,Iter beg
         ,Iter end
         ,args_pack<TArgs...> &set
     );
+    template<typename ...TArgs>
+    friend args_pack<TArgs...>& from_mapped_file(
+         std::string *emsg
+        ,const char *fname
+        ,args_pack<TArgs...> &args
+    );
+    template<typename IS, typename ...TArgs>
+    friend bool reload(std::string *emsg, IS &is, args_pack<TArgs...> &args);
+    template<typename ...TArgs>
+    friend parse_result parse_env(
+         std::string_view prefix
+        ,char* const* envp
+        ,args_pack<TArgs...> &args
+        ,e_unknown_env unknown
+    );
 
-    bool get_is_set(const std::string_view name) const {
-        bool res = false;
+    std::string_view keep_text(std::unique_ptr<details::text_storage> text) {
+        m_texts.push_back(std::move(text));
+
+        return m_texts.back()->text();
+    }
+
+    // returns the index of the option in the pack, or `details::npos`
+    static constexpr std::size_t index_of(const std::string_view name) noexcept {
+        return names_table.find(name);
+    }
+    // the same, but the upper case name of the environment variable is looked up in the lower case
+    static std::size_t env_index_of(const std::string_view name) noexcept {
+        constexpr std::size_t max_len = std::max({std::size_t{0}, Args::name().size()...});
+        if ( name.size() > max_len ) {
+            return details::npos;
+        }
+
+        char buf[max_len + 1];
+        for ( std::size_t i = 0; i < name.size(); ++i ) {
+            const char c = name[i];
+            buf[i] = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+        }
+        const auto idx = index_of(std::string_view{buf, name.size()});
+
+        return (idx != details::npos) ? idx : index_of(name);
+    }
+    static constexpr bool is_bool_type(std::size_t idx) noexcept {
+        return bool_types[idx];
+    }
+
+    // validates and converts the value for the option by its index
+    details::e_assign_status
+    assign(std::size_t idx, std::string_view val, details::e_assign_mode mode) {
+        auto res = details::e_assign_status::ok;
+        const auto *vdep = m_validator_dep[idx].get();
+        const auto *cdep = m_converter_dep[idx].get();
+        const bool has_deps = vdep || cdep;
+        if ( has_deps && m_deferred_targets.any() ) {
+            // the dependencies must see the converted values, so the options they refer to
+            // are converted once they are deferred.
+            // the failed ones stay deferred and are reported on the access.
+            for ( std::size_t i = 0; i < sizeof...(Args); ++i ) {
+                if ( m_deferred_targets.test(i) ) {
+                    std::as_const(*this).visit(i, [](const auto &item) { (void)item.materialize(); });
+                }
+            }
+            m_deferred_targets.reset();
+        }
+        visit(
+             idx
+            ,[this, &res, idx, val, mode, vdep, cdep, has_deps, lazy = m_lazy](auto &item) {
+                switch ( mode ) {
+                    case details::e_assign_mode::value: {
+                        if ( !has_deps && !item.is_atomic() && (lazy || item.is_lazy()) ) {
+                            item.defer(val);
+                            if ( m_dep_targets.test(idx) ) {
+                                m_deferred_targets.set(idx);
+                            }
+                        } else if ( !item.validate(val, vdep) ) {
+                            res = details::e_assign_status::invalid_value;
+                        } else if ( !item.convert(val, cdep) ) {
+                            res = details::e_assign_status::cant_convert;
+                        }
+                    } break;
+                    case details::e_assign_mode::flag: {
+                        item.convert(val, cdep);
+                    } break;
+                    case details::e_assign_mode::default_value: {
+                        if ( item.has_default() ) {
+                            item.set_value(item.get_default_value());
+                        }
+                    } break;
+                }
+                if ( res == details::e_assign_status::ok ) {
+                    store_atomic(idx, item);
+                }
+            }
+        );
+        if ( res == details::e_assign_status::ok ) {
+            m_is_set.set(idx);
+        }
+
+        return res;
+    }
+
+    // the value of the set option, or the default one, or nullptr
+    template<typename Option>
+    static const typename Option::value_type* effective_value(const Option &item) noexcept {
+        if ( item.m_value.has_value() ) {
+            return &*item.m_value;
+        }
+
+        return item.has_default() ? &item.get_default_value() : nullptr;
+    }
+
+    // takes the values and the texts of the `next` parsed from the same options,
+    // and calls the subscribers of the options of this pack whose values are changed.
+    // the values without `operator==` are considered changed when any of them is set.
+    // the texts of the previous version are kept until the next reload when any option
+    // can refer to them, so the values taken before the last reload stay valid.
+    void take_changes(args_pack &next) {
+        mask_type changed;
+        std::size_t idx = 0;
         for_each(
              m_kwords
-            ,[&res, &name](const auto &item) {
-                if ( item.name() == name ) {
-                    res = item.is_set();
+            ,[this, &next, &changed, &idx](auto &item) {
+                using option_type = std::decay_t<decltype(item)>;
+                using value_type = typename option_type::value_type;
+                auto &src = std::get<option_type>(next.m_kwords);
+
+                // the failed deferred value is compared as the unset one
+                (void)item.materialize();
+                const auto *prev = effective_value(item);
+                const auto *curr = effective_value(src);
+                if constexpr ( details::is_equality_comparable<value_type>::value ) {
+                    changed[idx] = (prev && curr) ? !(*prev == *curr) : (prev || curr);
+                } else {
+                    changed[idx] = item.m_value.has_value() || src.m_value.has_value();
                 }
-                return res == false;
+
+                item.m_value = std::move(src.m_value);
+                item.m_deferred = {};
+                item.m_is_deferred.store(false, std::memory_order_relaxed);
+                store_atomic(idx, item);
+                ++idx;
+
+                return true;
             }
             ,false
         );
+        m_is_set = next.m_is_set;
+        m_deferred_targets.reset();
+        if constexpr ( (details::may_refer_to_text<typename Args::value_type>::value || ...) ) {
+            m_prev_texts = std::move(m_texts);
+            m_texts = std::move(next.m_texts);
+        } else {
+            m_texts = std::move(next.m_texts);
+        }
 
-        return res;
-    }
+        // the subscribers are called when the whole pack is updated
+        auto &subscribers = details::subscribers_registry::instance();
+        if ( changed.none() || subscribers.empty() ) {
+            return;
+        }
 
-    std::string_view
-    check_for_unexpected(const std::string_view optname) const {
-        std::string_view res;
+        idx = 0;
         for_each(
              m_kwords
-            ,[&res, optname](const auto &item) {
-                if ( item.name() == optname ) {
-                    res = optname;
+            ,[this, &subscribers, &changed, &idx](const auto &item) {
+                if ( changed.test(idx) ) {
+                    using optional_type = typename std::decay_t<decltype(item)>::optional_type;
+                    const auto *value = effective_value(item);
+                    const optional_type arg = value ? optional_type{*value} : optional_type{};
+                    subscribers.notify(item.deps_key(), this, &arg);
                 }
-                return res.empty();
+                ++idx;
+
+                return true;
             }
             ,false
         );
+    }
+
+    // copies the parsed value, or the default one, into the cell of the `atomic` option
+    template<typename Option>
+    void store_atomic(std::size_t idx, const Option &item) const noexcept {
+        using value_type = typename Option::value_type;
+        if constexpr ( Option::is_atomic() ) {
+            const value_type v = item.m_value.has_value()
+                ? *item.m_value
+                : item.has_default() ? item.get_default_value() : value_type{}
+            ;
+            m_atomic_cells[atomic_cell_index[idx]].store(v);
+        } else {
+            (void)idx;
+            (void)item;
+        }
+    }
+
+    // converts all the deferred values, the first failure is thrown
+    void materialize_or_throw() const {
+        (void)std::initializer_list<int>{
+            (std::get<Args>(m_kwords).materialize_or_throw(), 0)...
+        };
+    }
 
-        return res.empty() ? optname : std::string_view{};
+    bool get_is_set(const std::string_view name) const {
+        const auto idx = index_of(name);
+
+        return idx != details::npos && m_is_set.test(idx);
     }
-    std::string_view check_for_required() const {
+
+    std::string_view name_at(std::size_t idx) const noexcept {
         std::string_view res;
+        visit(idx, [&res](const auto &item) { res = item.name(); });
+
+        return res;
+    }
+
+    // calls `f(option)` for the option with index `idx` through the jump table
+    template<typename F>
+    void visit(std::size_t idx, F &&f) {
+        visit_impl(*this, idx, f, std::make_index_sequence<sizeof...(Args)>{});
+    }
+    template<typename F>
+    void visit(std::size_t idx, F &&f) const {
+        visit_impl(*this, idx, f, std::make_index_sequence<sizeof...(Args)>{});
+    }
+    template<typename Pack, typename F, std::size_t ...I>
+    static void visit_impl(Pack &pack, std::size_t idx, F &f, std::index_sequence<I...>) {
+        if constexpr ( sizeof...(I) != 0u ) {
+            using handler_type = void(*)(Pack &, F &);
+            static constexpr handler_type handlers[] = {
+                [](Pack &p, F &fn) { fn(std::get<I>(p.m_kwords)); }...
+            };
+
+            handlers[idx](pack, f);
+        }
+    }
+
+    // returns the index of the first required option which is not set, or `details::npos`
+    std::size_t find_required() const noexcept {
+        std::size_t res = details::npos;
+        std::size_t idx = 0;
         for_each(
              m_kwords
-            ,[&res](const auto &item){
+            ,[&res, &idx](const auto &item){
                 if ( item.is_required() && !item.is_set() ) {
-                    res = item.name();
+                    res = idx;
                 }
-                return res.empty();
+                ++idx;
+
+                return res == details::npos;
              }
             ,false
         );
@@ -2016,89 +3936,84 @@ private:
         return res;
     }
 
-    using cond_ret_type = std::pair<
-         std::string_view
-        ,std::vector<std::string_view>
-    >;
-    cond_ret_type check_for_cond_and() const {
-        return check_for_conditional(
-            [](const auto &item) {
-                return item.is_set()
-                    ? item.and_list()
-                    : std::vector<std::string_view>{}
-                ;
+    // return the index of the first option with the broken relation, or `details::npos`
+    std::size_t find_cond_and() const noexcept {
+        for ( std::size_t i = 0; i < m_relations->size(); ++i ) {
+            const auto &rel = (*m_relations)[i];
+            if ( m_is_set.test(i) && (rel.and_unresolved || (rel.and_mask & ~m_is_set).any()) ) {
+                return i;
             }
-            ,[this](const auto &list) {
-                std::vector<std::string_view> res;
-                for ( const auto &it: list ) {
-                    bool is_set = get_is_set(it);
-                    if ( !is_set ) {
-                        res.push_back(it);
-                    }
-                }
-                return res;
-            }
-        );
+        }
+
+        return details::npos;
     }
-    cond_ret_type check_for_cond_or() const {
-        return check_for_conditional(
-             [](const auto &item) { return item.or_list(); }
-            ,[this](const auto &list) {
-                auto num = 0u;
-                std::vector<std::string_view> ret;
-                for ( const auto &it: list ) {
-                    bool is_set = get_is_set(it);
-                    if ( is_set ) {
-                        ++num;
-                        ret.push_back(it);
-                    }
-                }
-                if ( num == 1 ) {
-                    ret.clear();
-                } else {
-                    ret = list;
-                }
-                return ret;
+    std::size_t find_cond_or() const noexcept {
+        for ( std::size_t i = 0; i < m_relations->size(); ++i ) {
+            const auto &rel = (*m_relations)[i];
+            if ( rel.or_nonempty && (rel.or_mask & m_is_set).count() != 1u ) {
+                return i;
             }
-        );
+        }
+
+        return details::npos;
     }
-    cond_ret_type check_for_cond_not() const {
-        return check_for_conditional(
-             [](const auto &item) {
-                return item.is_set()
-                    ? item.not_list()
-                    : std::vector<std::string_view>{}
-                ;
-            }
-            ,[this](const auto &list) {
-                std::vector<std::string_view> ret;
-                for ( const auto &it: list ) {
-                    bool is_set = get_is_set(it);
-                    if ( is_set ) {
-                        ret.push_back(it);
-                    }
-                }
-                return ret;
+    std::size_t find_cond_not() const noexcept {
+        for ( std::size_t i = 0; i < m_relations->size(); ++i ) {
+            const auto &rel = (*m_relations)[i];
+            if ( m_is_set.test(i) && (rel.not_mask & m_is_set).any() ) {
+                return i;
             }
-        );
+        }
+
+        return details::npos;
     }
 
-private:
-    template<typename GetF, typename CmpF>
-    cond_ret_type check_for_conditional(const GetF &get, const CmpF &cmp) const {
-        cond_ret_type ret;
-        for_each(
-             m_kwords
-            ,[&get, &cmp, &ret](const auto &item) {
-                ret.first = item.name();
-                const auto &list = get(item);
-                ret.second = cmp(list);
-                return ret.second.empty();
+    // checks the required options and the relations when all the options are assigned
+    parse_result check_relations() const noexcept {
+        if ( const auto idx = find_required(); idx != details::npos ) {
+            return {e_parse_error::no_required, idx, details::npos, {}};
+        }
+        if ( const auto idx = find_cond_and(); idx != details::npos ) {
+            return {e_parse_error::cond_and, idx, details::npos, {}};
+        }
+        if ( const auto idx = find_cond_or(); idx != details::npos ) {
+            return {e_parse_error::cond_or, idx, details::npos, {}};
+        }
+        if ( const auto idx = find_cond_not(); idx != details::npos ) {
+            return {e_parse_error::cond_not, idx, details::npos, {}};
+        }
+
+        return {};
+    }
+
+    // the names which break the relation of the option with index `idx`
+    std::vector<std::string_view> cond_names(e_parse_error err, std::size_t idx) const {
+        std::vector<std::string_view> res;
+        visit(idx, [this, err, &res](const auto &item) {
+            switch ( err ) {
+                case e_parse_error::cond_and: {
+                    for ( const auto &it: item.and_list() ) {
+                        if ( !get_is_set(it) ) {
+                            res.push_back(it);
+                        }
+                    }
+                } break;
+                case e_parse_error::cond_or: {
+                    const auto &list = item.or_list();
+                    res.assign(list.begin(), list.end());
+                } break;
+                case e_parse_error::cond_not: {
+                    for ( const auto &it: item.not_list() ) {
+                        if ( get_is_set(it) ) {
+                            res.push_back(it);
+                        }
+                    }
+                } break;
+                default: break;
             }
-            ,false
-        );
+        });
 
-        return ret;
+        return res;
     }
 
 private:
@@ -2136,11 +4051,13 @@ namespace details {
 
 template<typename... Opts>
 struct validator_with_deps {
-    using fn_type = std::function<bool(
+    using fn_type = inplace_function<bool(
          std::string_view
         ,const std::optional<typename Opts::value_type> &...
     )>;
     fn_type f;
+    // the values of the dependencies in the pack the storage is bound to
+    std::tuple<const std::optional<typename Opts::value_type> *...> deps{};
 
     template<
          typename Fw
@@ -2152,25 +4069,28 @@ struct validator_with_deps {
         (void)std::initializer_list<int>{(static_cast<void>(opts), 0)...};
     }
 
-    template<typename ...P>
-    bool call(std::string_view s, const args_pack<P...> &pack) const {
-        static_assert((... && args_pack<P...>::template contains<std::decay_t<Opts>>()));
+    bool bind(const pack_view &pack) {
+        deps = std::make_tuple(pack.find<std::decay_t<Opts>>()...);
 
-        return f(
-            s
-            ,std::get<std::decay_t<Opts>>(pack.m_kwords).m_value...
-        );
+        return std::apply([](const auto *...p) { return (... && p); }, deps);
+    }
+
+    bool call(std::string_view s) const {
+        return std::apply([this, s](const auto *...p) { return f(s, *p...); }, deps);
     }
 };
 
 template<typename V, typename... Opts>
 struct converter_with_deps {
-    using fn_type = std::function<bool(
+    using value_type = V;
+    using fn_type = inplace_function<bool(
          V &
         ,std::string_view
         ,const std::optional<typename Opts::value_type> &...
     )>;
     fn_type f;
+    // the values of the dependencies in the pack the storage is bound to
+    std::tuple<const std::optional<typename Opts::value_type> *...> deps{};
 
     template<
          typename Fw
@@ -2182,637 +4102,345 @@ struct converter_with_deps {
         (void)std::initializer_list<int>{(static_cast<void>(opts), 0)...};
     }
 
-    template<typename ...P>
-    bool call(V &dst, std::string_view s, const args_pack<P...> &pack) const {
-        static_assert((... && args_pack<P...>::template contains<std::decay_t<Opts>>()));
+    bool bind(const pack_view &pack) {
+        deps = std::make_tuple(pack.find<std::decay_t<Opts>>()...);
 
-        return f(
-            dst
-            ,s
-            ,std::get<std::decay_t<Opts>>(pack.m_kwords).m_value...
-        );
+        return std::apply([](const auto *...p) { return (... && p); }, deps);
     }
-};
 
-/*************************************************************************************************/
-
-template<std::size_t I, typename ...P>
-using pack_option_t = std::tuple_element_t<I, std::tuple<P...>>;
-
-template<std::size_t I, typename ...P>
-inline bool try_rebind_validator_1(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(std::string_view)> &slot
-    ,args_pack<P...> &pack
-) {
-    using Ev = validator_with_deps<pack_option_t<I, P...>>;
-
-    if ( ti != typeid(Ev) ) {
-        return false;
+    bool call(V &dst, std::string_view s) const {
+        return std::apply([this, &dst, s](const auto *...p) { return f(dst, s, *p...); }, deps);
     }
+};
 
-    auto &v = *static_cast<Ev *>(stor.storage_obj_void());
-    slot = std::function<bool(std::string_view)>{
-        [&v, &pack](std::string_view s) noexcept -> bool {
-            return v.call(s, pack);
-        }
-    };
-
-    return true;
-}
-
-template<typename ...P, std::size_t ...I>
-inline bool rebind_validator_dispatch_1(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(std::string_view)> &slot
-    ,args_pack<P...> &pack
-    ,std::index_sequence<I...>
-) {
-    return (... || try_rebind_validator_1<I, P...>(ti, stor, slot, pack));
-}
-
-template<std::size_t I, std::size_t J, typename ...P>
-inline bool try_rebind_validator_2(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(std::string_view)> &slot
-    ,args_pack<P...> &pack
-) {
-    if constexpr ( I == J ) {
-        (void)ti;
-        (void)stor;
-        (void)slot;
-        (void)pack;
-
-        return false;
-    } else {
-        using Ev = validator_with_deps<
-             pack_option_t<I, P...>
-            ,pack_option_t<J, P...>
-        >;
+} // namespace details
 
-        if ( ti != typeid(Ev) ) {
-            return false;
-        }
+/*************************************************************************************************/
 
-        auto &v = *static_cast<Ev *>(stor.storage_obj_void());
-        slot = std::function<bool(std::string_view)>{
-            [&v, &pack](std::string_view s) noexcept -> bool {
-                return v.call(s, pack);
+// parses the key-value tokens into the `args`, without the allocations on failure
+template<typename Iter, typename ...Args>
+parse_result parse_kv_list(
+     const char *pref
+    ,std::size_t pref_len
+    ,Iter beg
+    ,Iter end
+    ,args_pack<Args...> &args)
+{
+    for ( std::size_t token = 0; beg != end; ++beg, ++token ) {
+        const std::string_view item{*beg};
+        if ( pref ) {
+            if ( item.compare(0, pref_len, pref, pref_len) != 0 ) {
+                continue;
             }
-        };
-
-        return true;
-    }
-}
-
-template<std::size_t K, typename ...P>
-inline bool try_rebind_validator_2_flat(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(std::string_view)> &slot
-    ,args_pack<P...> &pack
-) {
-    constexpr std::size_t n = sizeof...(P);
-    constexpr std::size_t i = K / n;
-    constexpr std::size_t j = K % n;
-
-    return try_rebind_validator_2<i, j, P...>(ti, stor, slot, pack);
-}
-
-template<typename ...P, std::size_t ...K>
-inline bool rebind_validator_dispatch_2(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(std::string_view)> &slot
-    ,args_pack<P...> &pack
-    ,std::index_sequence<K...>
-) {
-    return (... || try_rebind_validator_2_flat<K, P...>(ti, stor, slot, pack));
-}
-
-template<std::size_t I, std::size_t J, std::size_t L, typename ...P>
-inline bool try_rebind_validator_3(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(std::string_view)> &slot
-    ,args_pack<P...> &pack
-) {
-    if constexpr ( I == J || I == L || J == L ) {
-        (void)ti;
-        (void)stor;
-        (void)slot;
-        (void)pack;
+        }
+        std::string_view line = pref ? item.substr(pref_len) : item;
+        line = cmdargs::details::trim(line);
 
-        return false;
-    } else {
-        using Ev = validator_with_deps<
-             pack_option_t<I, P...>
-            ,pack_option_t<J, P...>
-            ,pack_option_t<L, P...>
-        >;
+        auto pos = line.find('=');
+        std::string_view key = (pos != std::string_view::npos)
+            ? line.substr(0u, pos)
+            : line
+        ;
 
-        if ( ti != typeid(Ev) ) {
-            return false;
+        const auto idx = args.index_of(key);
+        if ( idx == details::npos ) {
+            return {e_parse_error::extra_option, idx, token, key};
         }
 
-        auto &v = *static_cast<Ev *>(stor.storage_obj_void());
-        slot = std::function<bool(std::string_view)>{
-            [&v, &pack](std::string_view s) noexcept -> bool {
-                return v.call(s, pack);
+        if ( pos != std::string_view::npos ) {
+            std::string_view val = line.substr(pos + 1);
+            const auto status = args.assign(idx, val, details::e_assign_mode::value);
+            if ( status != details::e_assign_status::ok ) {
+                return {
+                     (status == details::e_assign_status::invalid_value)
+                        ? e_parse_error::invalid_value
+                        : e_parse_error::cant_convert
+                    ,idx
+                    ,token
+                    ,val
+                };
             }
-        };
-
-        return true;
-    }
-}
-
-template<std::size_t Flat, typename ...P>
-inline bool try_rebind_validator_3_flat(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(std::string_view)> &slot
-    ,args_pack<P...> &pack
-) {
-    constexpr std::size_t n = sizeof...(P);
-    constexpr std::size_t i = Flat / (n * n);
-    constexpr std::size_t j = (Flat / n) % n;
-    constexpr std::size_t k = Flat % n;
-
-    return try_rebind_validator_3<i, j, k, P...>(ti, stor, slot, pack);
-}
-
-template<typename ...P, std::size_t ...K>
-inline bool rebind_validator_dispatch_3(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(std::string_view)> &slot
-    ,args_pack<P...> &pack
-    ,std::index_sequence<K...>
-) {
-    return (... || try_rebind_validator_3_flat<K, P...>(ti, stor, slot, pack));
-}
-
-template<typename ...P>
-inline bool rebind_validator_storage_into(
-     deps_storage_base *stor
-    ,std::function<bool(std::string_view)> &slot
-    ,args_pack<P...> &pack
-) {
-    if ( !stor ) {
-        return false;
-    }
-
-    const std::type_info &ti = stor->storage_type();
-    deps_storage_base &s = *stor;
-    constexpr std::size_t n = sizeof...(P);
-
-    if ( rebind_validator_dispatch_1<P...>(ti, s, slot, pack, std::make_index_sequence<n>{}) ) {
-        return true;
-    }
+        } else {
+            if ( key != details::version_option_type::name() ) {
+                if ( !args.is_bool_type(idx) ) {
+                    return {e_parse_error::no_value, idx, token, key};
+                }
 
-#if CMDARGS_MAX_OPTION_DEPS >= 2
-    if constexpr ( n >= 2u ) {
-        if ( rebind_validator_dispatch_2<P...>(
-                ti, s, slot, pack, std::make_index_sequence<n * n>{}
-            ) )
-        {
-            return true;
-        }
-    }
-#endif
+                args.assign(idx, "true", details::e_assign_mode::flag);
+            } else {
+                // version case
+                args.assign(idx, {}, details::e_assign_mode::default_value);
+            }
 
-#if CMDARGS_MAX_OPTION_DEPS >= 3
-    if constexpr ( n >= 3u ) {
-        if ( rebind_validator_dispatch_3<P...>(
-                ti, s, slot, pack, std::make_index_sequence<n * n * n>{}
-            ) )
-        {
-            return true;
+            if ( key == details::help_option_type::name()
+                || key == details::version_option_type::name() )
+            {
+                return {};
+            }
         }
     }
-#endif
 
-    return false;
+    return args.check_relations();
 }
 
-template<typename V, std::size_t I, typename ...P>
-inline bool try_rebind_converter_1(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(V &, std::string_view)> &slot
-    ,args_pack<P...> &pack
-) {
-    using Ec = converter_with_deps<V, pack_option_t<I, P...>>;
+namespace details {
 
-    if ( ti != typeid(Ec) ) {
-        return false;
+// the failed `res` is reported into the `emsg` if it's not nullptr, or thrown otherwise
+template<typename ...Args>
+void report_error(
+     std::string *emsg
+    ,const parse_result &res
+    ,const args_pack<Args...> &args
+    ,const char *pref)
+{
+    if ( res ) {
+        return;
     }
 
-    auto &c = *static_cast<Ec *>(stor.storage_obj_void());
-    slot = std::function<bool(V &, std::string_view)>{
-        [&c, &pack](V &dst, std::string_view s) -> bool {
-            return c.call(dst, s, pack);
-        }
-    };
-
-    return true;
-}
-
-template<typename V, typename ...P, std::size_t ...I>
-inline bool rebind_converter_dispatch_1(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(V &, std::string_view)> &slot
-    ,args_pack<P...> &pack
-    ,std::index_sequence<I...>
-) {
-    return (... || try_rebind_converter_1<V, I, P...>(ti, stor, slot, pack));
-}
-
-template<typename V, std::size_t I, std::size_t J, typename ...P>
-inline bool try_rebind_converter_2(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(V &, std::string_view)> &slot
-    ,args_pack<P...> &pack
-) {
-    if constexpr ( I == J ) {
-        (void)ti;
-        (void)stor;
-        (void)slot;
-        (void)pack;
-
-        return false;
+    std::string msg = args.error_message(res, pref);
+    if ( emsg ) {
+        *emsg = std::move(msg);
     } else {
-        using Ec = converter_with_deps<
-             V
-            ,pack_option_t<I, P...>
-            ,pack_option_t<J, P...>
-        >;
-
-        if ( ti != typeid(Ec) ) {
-            return false;
-        }
-
-        auto &c = *static_cast<Ec *>(stor.storage_obj_void());
-        slot = std::function<bool(V &, std::string_view)>{
-            [&c, &pack](V &dst, std::string_view s) -> bool {
-                return c.call(dst, s, pack);
-            }
-        };
-
-        return true;
+        CMDARGS_THROW(invalid_argument(std::move(msg)));
     }
 }
 
-template<typename V, std::size_t K, typename ...P>
-inline bool try_rebind_converter_2_flat(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(V &, std::string_view)> &slot
-    ,args_pack<P...> &pack
-) {
-    constexpr std::size_t n = sizeof...(P);
-    constexpr std::size_t i = K / n;
-    constexpr std::size_t j = K % n;
+} // ns details
 
-    return try_rebind_converter_2<V, i, j, P...>(ti, stor, slot, pack);
+template<typename Iter, typename ...Args>
+void parse_kv_list(
+     std::string *emsg
+    ,const char *pref
+    ,std::size_t pref_len
+    ,Iter beg
+    ,Iter end
+    ,args_pack<Args...> &args)
+{
+    const auto res = parse_kv_list(pref, pref_len, beg, end, args);
+    details::report_error(emsg, res, args, pref);
 }
 
-template<typename V, typename ...P, std::size_t ...K>
-inline bool rebind_converter_dispatch_2(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(V &, std::string_view)> &slot
-    ,args_pack<P...> &pack
-    ,std::index_sequence<K...>
-) {
-    return (... || try_rebind_converter_2_flat<V, K, P...>(ti, stor, slot, pack));
-}
+/*************************************************************************************************/
 
-template<typename V, std::size_t I, std::size_t J, std::size_t L, typename ...P>
-inline bool try_rebind_converter_3(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(V &, std::string_view)> &slot
-    ,args_pack<P...> &pack
-) {
-    if constexpr ( I == J || I == L || J == L ) {
-        (void)ti;
-        (void)stor;
-        (void)slot;
-        (void)pack;
+template<
+     typename ...Args
+    ,typename = typename std::enable_if_t<
+        sizeof...(Args) != 1
+            && !std::is_base_of_v<
+                 kwords_group
+                ,typename std::tuple_element<0, std::tuple<Args...>>::type
+        >
+    >
+>
+auto parse_args(std::string *emsg, int argc, char* const* argv, const Args & ...kwords) {
+    char *const *beg = argv+1;
+    char *const *end = argv+argc;
+    args_pack<details::option_of_t<Args>...> set{kwords...};
+    parse_kv_list(emsg, "--", 2, beg, end, set);
 
-        return false;
-    } else {
-        using Ec = converter_with_deps<
-             V
-            ,pack_option_t<I, P...>
-            ,pack_option_t<J, P...>
-            ,pack_option_t<L, P...>
-        >;
-
-        if ( ti != typeid(Ec) ) {
-            return false;
-        }
+    return set;
+}
 
-        auto &c = *static_cast<Ec *>(stor.storage_obj_void());
-        slot = std::function<bool(V &, std::string_view)>{
-            [&c, &pack](V &dst, std::string_view s) -> bool {
-                return c.call(dst, s, pack);
-            }
-        };
+template<typename ...Args>
+auto parse_args(std::string *emsg, int argc, char* const* argv, const std::tuple<Args...> &kwords) {
+    char *const *beg = argv+1;
+    char *const *end = argv+argc;
+    args_pack<details::option_of_t<Args>...> set{std::get<Args>(kwords)...};
+    parse_kv_list(emsg, "--", 2, beg, end, set);
 
-        return true;
-    }
+    return set;
 }
 
-template<typename V, std::size_t Flat, typename ...P>
-inline bool try_rebind_converter_3_flat(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(V &, std::string_view)> &slot
-    ,args_pack<P...> &pack
-) {
-    constexpr std::size_t n = sizeof...(P);
-    constexpr std::size_t i = Flat / (n * n);
-    constexpr std::size_t j = (Flat / n) % n;
-    constexpr std::size_t k = Flat % n;
+template<
+     typename KWords
+    ,typename = typename std::enable_if_t<
+        std::is_class_v<KWords> &&
+        std::is_base_of_v<kwords_group, KWords>
+    >
+>
+auto parse_args(std::string *emsg, int argc, char* const* argv, const KWords &kw) {
+    const auto &tuple = details::to_tuple(kw);
 
-    return try_rebind_converter_3<V, i, j, k, P...>(ti, stor, slot, pack);
-}
+    auto res = parse_args(emsg, argc, argv, tuple);
 
-template<typename V, typename ...P, std::size_t ...K>
-inline bool rebind_converter_dispatch_3(
-     const std::type_info &ti
-    ,deps_storage_base &stor
-    ,std::function<bool(V &, std::string_view)> &slot
-    ,args_pack<P...> &pack
-    ,std::index_sequence<K...>
-) {
-    return (... || try_rebind_converter_3_flat<V, K, P...>(ti, stor, slot, pack));
+    return res;
 }
 
-template<typename V, typename ...P>
-inline bool rebind_converter_storage_into(
-     deps_storage_base *stor
-    ,std::function<bool(V &, std::string_view)> &slot
-    ,args_pack<P...> &pack
-) {
-    if ( !stor ) {
-        return false;
-    }
-
-    const std::type_info &ti = stor->storage_type();
-    deps_storage_base &s = *stor;
-    constexpr std::size_t n = sizeof...(P);
+/*************************************************************************************************/
+// environment variables
+// the options are set from the variables named by the `prefix` and the option name in the upper
+// or the lower case, i.e. the `fname` option is set by the `APP_FNAME` for the "APP_" prefix.
+// the environment is walked once, and the values are passed to the validators and converters
+// without copying, so the environment must not be changed while the `std::string_view`
+// or the deferred values of the `args` are used.
 
-    if ( rebind_converter_dispatch_1<V, P...>(ti, s, slot, pack, std::make_index_sequence<n>{}) ) {
-        return true;
-    }
+namespace details {
 
-#if CMDARGS_MAX_OPTION_DEPS >= 2
-    if constexpr ( n >= 2u ) {
-        if ( rebind_converter_dispatch_2<V, P...>(
-                ti, s, slot, pack, std::make_index_sequence<n * n>{}
-            ) )
-        {
-            return true;
-        }
-    }
+#if !defined(__APPLE__) && !defined(_WIN32)
+// the declaration with the C linkage refers to the global `environ`,
+// but the name is not declared in the global namespace
+extern "C" char **environ;
 #endif
 
-#if CMDARGS_MAX_OPTION_DEPS >= 3
-    if constexpr ( n >= 3u ) {
-        if ( rebind_converter_dispatch_3<V, P...>(
-                ti, s, slot, pack, std::make_index_sequence<n * n * n>{}
-            ) )
-        {
-            return true;
-        }
-    }
+inline char* const* environment() noexcept {
+#if defined(__APPLE__)
+    return *::_NSGetEnviron();
+#elif defined(_WIN32)
+    return _environ;
+#else
+    return environ;
 #endif
-
-    return false;
 }
 
-} // namespace details
-
-/*************************************************************************************************/
+} // ns details
 
-template<typename Iter, typename ...Args>
-void parse_kv_list(
-     std::string *emsg
-    ,const char *pref
-    ,std::size_t pref_len
-    ,Iter beg
-    ,Iter end
-    ,args_pack<Args...> &args)
+template<typename ...Args>
+parse_result parse_env(
+     std::string_view prefix
+    ,char* const* envp
+    ,args_pack<Args...> &args
+    ,e_unknown_env unknown)
 {
-    for ( ; beg != end; ++beg ) {
-        if ( pref ) {
-            std::string_view pref_sv{pref, pref_len};
-            if ( pref_sv.compare(0, pref_len, *beg, pref_len) != 0 ) {
-                continue;
-            }
-        }
-        std::string_view line = pref ? (*beg) + pref_len : (*beg);
-        line = cmdargs::details::trim(line);
-
-        auto pos = line.find('=');
-        std::string_view key = (pos != std::string_view::npos)
-            ? line.substr(0u, pos)
-            : line
-        ;
-
-        auto unexpected = args.check_for_unexpected(key);
-        if ( !unexpected.empty() ) {
-            std::string msg = "there is an extra \"";
-            msg += (pref ? pref : "");
-            msg += unexpected;
-            msg += "\" option was specified";
+    for ( std::size_t token = 0; envp && envp[token]; ++token ) {
+        const std::string_view item{envp[token]};
+        if ( item.compare(0, prefix.size(), prefix) != 0 ) {
+            continue;
+        }
+        const auto pos = item.find('=', prefix.size());
+        if ( pos == std::string_view::npos ) {
+            continue;
+        }
 
-            if ( emsg ) {
-                *emsg = std::move(msg);
-            } else {
-                throw invalid_argument(msg);
+        const auto key = item.substr(prefix.size(), pos - prefix.size());
+        const auto idx = args.env_index_of(key);
+        if ( idx == details::npos ) {
+            if ( unknown == e_unknown_env::skip ) {
+                continue;
             }
 
-            return;
+            return {e_parse_error::extra_option, idx, token, item.substr(0, pos)};
         }
 
-        if ( pos != std::string_view::npos ) {
-            std::string msg;
-            std::string_view val = line.substr(pos + 1);
-            args.for_each(
-                [pref, key, val, &msg](auto &item) {
-                    if ( item.name() == key ) {
-                        if ( !item.validate(val) ) {
-                            msg = "an invalid value \"";
-                            msg += val;
-                            msg += "\" was received for \"";
-                            msg += (pref ? pref : "");
-                            msg += key;
-                            msg += "\" option";
-
-                            return false;
-                        }
-                        if ( !item.convert(val) ) {
-                            msg = "can't convert value \"";
-                            msg += val;
-                            msg += "\" for \"";
-                            msg += (pref ? pref : "");
-                            msg += key;
-                            msg += "\" option";
-
-                            return false;
-                        }
-                        return false;
-                    }
-                    return true;
-                }
-                ,false
-            );
+        const auto val = item.substr(pos + 1);
+        const auto status = args.assign(idx, val, details::e_assign_mode::value);
+        if ( status != details::e_assign_status::ok ) {
+            return {
+                 (status == details::e_assign_status::invalid_value)
+                    ? e_parse_error::invalid_value
+                    : e_parse_error::cant_convert
+                ,idx
+                ,token
+                ,val
+            };
+        }
+    }
 
-            if ( !msg.empty() ) {
-                if ( emsg ) {
-                    *emsg = std::move(msg);
-                } else {
-                    throw invalid_argument(msg);
-                }
+    return args.check_relations();
+}
 
-                return;
-            }
-        } else {
-            if ( key != details::version_option_type::name() ) {
-                if ( !args.is_bool_type(key) ) {
-                    std::string msg = "a value must be provided for \"";
-                    msg += (pref ? pref : "");
-                    msg += key;
-                    msg += "\" option";
-
-                    if ( emsg ) {
-                        *emsg = std::move(msg);
-                    } else {
-                        throw invalid_argument(msg);
-                    }
+template<typename ...Args>
+args_pack<Args...>& parse_env(
+     std::string *emsg
+    ,std::string_view prefix
+    ,args_pack<Args...> &args
+    ,e_unknown_env unknown = e_unknown_env::skip)
+{
+    const auto res = parse_env(prefix, details::environment(), args, unknown);
+    details::report_error(emsg, res, args, nullptr);
 
-                    return;
-                }
+    return args;
+}
 
-                args.for_each(
-                    [key](auto &item) {
-                        if ( item.name() == key ) {
-                            static const std::string_view _true{"true"};
-                            item.convert(_true);
-                            return false;
-                        }
-                        return true;
-                    }
-                    ,false
-                );
-            } else {
-                // version case
-                args.for_each(
-                    [](auto &item) {
-                        if ( item.name() == details::version_option_type::name() ) {
-                            item.set_value(item.get_default_value());
-                            return false;
-                        }
-                        return true;
-                    }
-                    ,false
-                );
-            }
+template<
+     typename ...Args
+    ,typename = typename std::enable_if_t<
+        sizeof...(Args) != 1 && !std::is_base_of_v<
+             kwords_group
+            ,typename std::tuple_element<0, std::tuple<Args...>>::type
+        >
+    >
+>
+auto parse_env(std::string *emsg, std::string_view prefix, const Args & ...kwords) {
+    args_pack<details::option_of_t<Args>...> args{kwords...};
+    parse_env(emsg, prefix, args);
 
-            if ( key == details::help_option_type::name()
-                || key == details::version_option_type::name() )
-            {
-                return;
-            }
-        }
-    }
+    return args;
+}
 
-    auto required = args.check_for_required();
-    if ( !required.empty() ) {
-        std::string msg = "no required \"";
-        msg += (pref ? pref : "");
-        msg += required;
-        msg += "\" option was specified";
+template<typename ...Args>
+auto parse_env(std::string *emsg, std::string_view prefix, const std::tuple<Args...> &kwords) {
+    args_pack<details::option_of_t<Args>...> args{std::get<Args>(kwords)...};
+    parse_env(emsg, prefix, args);
 
-        if ( emsg ) {
-            *emsg = std::move(msg);
-        } else {
-            throw invalid_argument(msg);
-        }
+    return args;
+}
 
-        return;
-    }
+template<
+     typename KWords
+    ,typename = typename std::enable_if_t<
+        std::is_class_v<KWords> &&
+        std::is_base_of_v<kwords_group, KWords>
+    >
+>
+auto parse_env(std::string *emsg, std::string_view prefix, const KWords &kw) {
+    const auto &tuple = details::to_tuple(kw);
 
-    auto cond_and = args.check_for_cond_and();
-    if ( !cond_and.second.empty() ) {
-        std::string names = details::cat_vector(pref, cond_and.second);
-        std::string msg = "the \"";
-        msg += (pref ? pref : "");
-        msg += cond_and.first;
-        msg += "\" option must be used together with \"";
-        msg += names;
-        msg += "\"";
+    return parse_env(emsg, prefix, tuple);
+}
 
-        if ( emsg ) {
-            *emsg = std::move(msg);
-        } else {
-            throw invalid_argument(msg);
-        }
+/*************************************************************************************************/
+// compiled parser
+// for the high-rate re-parsing: the args_pack is built once and then refilled in place
 
-        return;
-    }
+template<typename ...Args>
+struct compiled_parser {
+    using pack_type = args_pack<Args...>;
+
+    // the parser keeps the empty pack of the options, so it doesn't refer to the `kwords`
+    explicit compiled_parser(const Args & ...kwords, const char *pref = "--")
+        :m_proto{kwords...}
+        ,m_pref{pref}
+        ,m_pref_len{pref ? std::char_traits<char>::length(pref) : 0u}
+    {}
 
-    auto cond_or = args.check_for_cond_or();
-    if ( !cond_or.second.empty() ) {
-        std::string names = details::cat_vector(pref, cond_or.second, true);
-        std::string msg = "the \"";
-        msg += (pref ? pref : "");
-        msg += cond_or.first;
-        msg += "\" option must be used together with ";
-        if ( cond_or.second.size() > 1 ) {
-            msg += "one of ";
-        }
-        msg += names;
+    pack_type make_pack() const {
+        return pack_type{typename pack_type::empty_copy_t{}, m_proto};
+    }
 
-        if ( emsg ) {
-            *emsg = std::move(msg);
-        } else {
-            throw invalid_argument(msg);
-        }
+    // resets the `pack` and fills it from the tokens.
+    // no heap allocations are performed except those made by the options values itself.
+    template<typename Iter>
+    parse_result parse(Iter beg, Iter end, pack_type &pack) const {
+        pack.reset();
 
-        return;
+        return parse_kv_list(m_pref, m_pref_len, beg, end, pack);
+    }
+    template<typename Tokens>
+    parse_result parse(const Tokens &tokens, pack_type &pack) const {
+        return parse(std::begin(tokens), std::end(tokens), pack);
     }
 
-    auto cond_not = args.check_for_cond_not();
-    if ( !cond_not.second.empty() ) {
-        std::string names = details::cat_vector(pref, cond_not.second, true);
-        std::string msg = "the \"";
-        msg += (pref ? pref : "");
-        msg += cond_not.first;
-        msg += "\" option can't be used together with ";
-        if ( cond_not.second.size() > 1 ) {
-            msg += "one of ";
-        }
-        msg += names;
+    // the same, but the error message is formatted into the `emsg`, or thrown if it's nullptr
+    template<typename Iter>
+    bool parse(std::string *emsg, Iter beg, Iter end, pack_type &pack) const {
+        const auto res = parse(beg, end, pack);
+        details::report_error(emsg, res, pack, m_pref);
 
-        if ( emsg ) {
-            *emsg = std::move(msg);
-        } else {
-            throw invalid_argument(msg);
-        }
+        return static_cast<bool>(res);
+    }
+    template<typename Tokens>
+    bool parse(std::string *emsg, const Tokens &tokens, pack_type &pack) const {
+        return parse(emsg, std::begin(tokens), std::end(tokens), pack);
+    }
+    bool parse(std::string *emsg, int argc, char* const* argv, pack_type &pack) const {
+        return parse(emsg, argv + 1, argv + argc, pack);
     }
-}
 
-/*************************************************************************************************/
+private:
+    pack_type m_proto;
+    const char *m_pref;
+    std::size_t m_pref_len;
+};
 
 template<
      typename ...Args
@@ -2824,23 +4452,13 @@ template<
         >
     >
 >
-auto parse_args(std::string *emsg, int argc, char* const* argv, const Args & ...kwords) {
-    char *const *beg = argv+1;
-    char *const *end = argv+argc;
-    args_pack<typename std::decay_t<Args>...> set{kwords...};
-    parse_kv_list(emsg, "--", 2, beg, end, set);
-
-    return set;
+auto compile(const Args & ...kwords) {
+    return compiled_parser<details::option_of_t<Args>...>{kwords...};
 }
 
 template<typename ...Args>
-auto parse_args(std::string *emsg, int argc, char* const* argv, const std::tuple<Args...> &kwords) {
-    char *const *beg = argv+1;
-    char *const *end = argv+argc;
-    args_pack<typename std::decay_t<Args>...> set{std::get<Args>(kwords)...};
-    parse_kv_list(emsg, "--", 2, beg, end, set);
-
-    return set;
+auto compile(const std::tuple<Args...> &kwords) {
+    return compiled_parser<details::option_of_t<Args>...>{std::get<Args>(kwords)...};
 }
 
 template<
@@ -2850,19 +4468,17 @@ template<
         std::is_base_of_v<kwords_group, KWords>
     >
 >
-auto parse_args(std::string *emsg, int argc, char* const* argv, const KWords &kw) {
+auto compile(const KWords &kw) {
     const auto &tuple = details::to_tuple(kw);
 
-    auto res = parse_args(emsg, argc, argv, tuple);
-
-    return res;
+    return compile(tuple);
 }
 
 /*************************************************************************************************/
 
 template<typename ...Args>
 auto make_args(Args && ...args) {
-    cmdargs::args_pack<typename std::decay_t<Args>...> set{std::forward<Args>(args)...};
+    cmdargs::args_pack<details::option_of_t<Args>...> set{std::forward<Args>(args)...};
 
     return set;
 }
@@ -2881,7 +4497,7 @@ OS& to_file(OS &os, const args_pack<Args...> &args, bool inited_only = true) {
                 const auto &value = (!is_set) ? item.get_default_value() : item.get_value();
                 using decayed = typename std::decay_t<decltype(item)>;
                 if constexpr ( std::is_same_v<typename decayed::value_type, bool> ) {
-                    os << value ? "true" : "false";
+                    os << (value ? "true" : "false");
                 } else {
                     os << value;
                 }
@@ -2899,28 +4515,33 @@ OS& to_file(OS &os, const args_pack<Args...> &args, bool inited_only = true) {
     return os;
 }
 
-template<typename IS, typename ...Args>
-auto& from_file(std::string *emsg, IS &is, args_pack<Args...> &args) {
-    std::vector<std::string> lines;
-    for ( std::string line; std::getline(is, line); ) {
-        details::trim(line);
-
-        if ( !line.empty() && line.front() == '#' ) {
-            line.clear();
-
-            continue;
-        }
+namespace details {
 
-        lines.push_back(std::move(line));
+template<typename IS>
+std::string read_text(IS &is) {
+    std::string text;
+    for ( std::string line; std::getline(is, line); ) {
+        text += line;
+        text += endl;
     }
 
-    std::vector<const char*> linesptrs;
-    linesptrs.reserve(lines.size());
-    for ( const auto &it: lines ) {
-        linesptrs.push_back(it.c_str());
-    }
+    return text;
+}
 
-    parse_kv_list(emsg, nullptr, 0, linesptrs.begin(), linesptrs.end(), args);
+} // ns details
+
+// the stream content is moved into the `args`, so the `std::string_view` options stay valid
+template<typename IS, typename ...Args>
+auto& from_file(std::string *emsg, IS &is, args_pack<Args...> &args) {
+    const auto view = args.keep_text(details::read_text(is));
+    parse_kv_list(
+         emsg
+        ,nullptr
+        ,0
+        ,details::config_lines_iterator{view}
+        ,details::config_lines_iterator{}
+        ,args
+    );
 
     return args;
 }
@@ -2936,7 +4557,7 @@ template<
     >
 >
 auto from_file(std::string *emsg, IS &is, const Args & ...kwords) {
-    args_pack<typename std::decay_t<Args>...> args{kwords...};
+    args_pack<details::option_of_t<Args>...> args{kwords...};
     from_file(emsg, is, args);
 
     return args;
@@ -2944,7 +4565,7 @@ auto from_file(std::string *emsg, IS &is, const Args & ...kwords) {
 
 template<typename IS, typename ...Args>
 auto from_file(std::string *emsg, IS &is, const std::tuple<Args...> &kwords) {
-    args_pack<typename std::decay_t<Args>...> args{std::get<Args>(kwords)...};
+    args_pack<details::option_of_t<Args>...> args{std::get<Args>(kwords)...};
     from_file(emsg, is, args);
 
     return args;
@@ -2964,6 +4585,269 @@ auto from_file(std::string *emsg, IS &is, const KWords &kw) {
     return from_file(emsg, is, tuple);
 }
 
+// parses the stream into the new values of the options of the `args`.
+// on success the `args` takes the new values, and the subscribers of the options
+// whose values are changed are called, see `option_decl::subscribe()`.
+// on error the `args` is kept unchanged.
+template<typename IS, typename ...Args>
+bool reload(std::string *emsg, IS &is, args_pack<Args...> &args) {
+    using pack_type = args_pack<Args...>;
+    pack_type next{typename pack_type::empty_copy_t{}, std::as_const(args)};
+    const auto view = next.keep_text(details::read_text(is));
+    auto res = parse_kv_list(
+         nullptr
+        ,0
+        ,details::config_lines_iterator{view}
+        ,details::config_lines_iterator{}
+        ,next
+    );
+    if ( res ) {
+        res = next.materialize_all();
+    }
+    details::report_error(emsg, res, next, nullptr);
+    if ( !res ) {
+        return false;
+    }
+
+    args.take_changes(next);
+
+    return true;
+}
+
+// the file is mapped into memory and parsed in place, the mapping is owned by the `args`
+template<typename ...Args>
+args_pack<Args...>& from_mapped_file(std::string *emsg, const char *fname, args_pack<Args...> &args) {
+    auto file = std::make_unique<details::mapped_file>(fname);
+    if ( !file->is_open() ) {
+        const parse_result res{e_parse_error::cant_open, details::npos, details::npos, fname};
+        details::report_error(emsg, res, args, nullptr);
+
+        return args;
+    }
+
+    const auto text = args.keep_text(std::move(file));
+    parse_kv_list(
+         emsg
+        ,nullptr
+        ,0
+        ,details::config_lines_iterator{text}
+        ,details::config_lines_iterator{}
+        ,args
+    );
+
+    return args;
+}
+
+template<
+     typename ...Args
+    ,typename = typename std::enable_if_t<
+        sizeof...(Args) != 1 && !std::is_base_of_v<
+             kwords_group
+            ,typename std::tuple_element<0, std::tuple<Args...>>::type
+        >
+    >
+>
+auto from_mapped_file(std::string *emsg, const char *fname, const Args & ...kwords) {
+    args_pack<details::option_of_t<Args>...> args{kwords...};
+    from_mapped_file(emsg, fname, args);
+
+    return args;
+}
+
+template<typename ...Args>
+auto from_mapped_file(std::string *emsg, const char *fname, const std::tuple<Args...> &kwords) {
+    args_pack<details::option_of_t<Args>...> args{std::get<Args>(kwords)...};
+    from_mapped_file(emsg, fname, args);
+
+    return args;
+}
+
+template<
+     typename KWords
+    ,typename = typename std::enable_if_t<
+        std::is_class_v<KWords> &&
+        std::is_base_of_v<kwords_group, KWords>
+    >
+>
+auto from_mapped_file(std::string *emsg, const char *fname, const KWords &kw) {
+    const auto &tuple = details::to_tuple(kw);
+
+    return from_mapped_file(emsg, fname, tuple);
+}
+
+/*************************************************************************************************/
+// live config
+// the hot-reloadable configuration for the multi-threaded programs: the new args_pack is parsed
+// off the read path and published as the immutable snapshot by the atomic swap.
+// the readers always see the consistent pack, and the old snapshot is destroyed
+// when the last reader holding it is done with it.
+
+template<typename Pack>
+struct live_config;
+
+template<typename ...Args>
+struct live_config<args_pack<Args...>> {
+    using pack_type = args_pack<Args...>;
+    using snapshot_type = std::shared_ptr<const pack_type>;
+
+    // the live_config keeps the empty pack of the options, so it doesn't refer to the `kwords`
+    explicit live_config(const Args & ...kwords)
+        :m_proto{kwords...}
+        ,m_current{make_pack()}
+    {}
+
+    live_config(const live_config &) = delete;
+    live_config& operator= (const live_config &) = delete;
+
+    // the empty pack to be filled and published.
+    // the pack is constructed in place, so the validator_/converter_ dependencies stay bound.
+    std::shared_ptr<pack_type> make_pack() const {
+        return std::make_shared<pack_type>(typename pack_type::empty_copy_t{}, m_proto);
+    }
+
+    // the current snapshot. the snapshot stays valid while it's held,
+    // regardless of the following publications.
+    snapshot_type snapshot() const {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        return m_current.load(std::memory_order_acquire);
+#else
+        return std::atomic_load_explicit(&m_current, std::memory_order_acquire);
+#endif
+    }
+
+    // the number of the publications, incremented after the new snapshot is visible
+    std::uint64_t version() const noexcept { return m_version.load(std::memory_order_acquire); }
+
+    // the deferred values of the pack are converted before the publication,
+    // so the snapshot is never modified by the readers.
+    // returns false and keeps the current snapshot if the pack can't be converted.
+    bool publish(std::string *emsg, std::shared_ptr<pack_type> pack) {
+        const auto res = pack->materialize_all();
+        details::report_error(emsg, res, *pack, nullptr);
+        if ( !res ) {
+            return false;
+        }
+
+        snapshot_type next{std::move(pack)};
+#if defined(__cpp_lib_atomic_shared_ptr)
+        m_current.store(std::move(next), std::memory_order_release);
+#else
+        std::atomic_store_explicit(&m_current, std::move(next), std::memory_order_release);
+#endif
+        m_version.fetch_add(1, std::memory_order_release);
+
+        return true;
+    }
+
+    // parses the stream into the new pack and publishes it.
+    // on error the current snapshot is kept.
+    template<typename IS>
+    bool reload_from_file(std::string *emsg, IS &is) {
+        auto pack = make_pack();
+        const auto text = pack->keep_text(details::read_text(is));
+        const auto res = parse_kv_list(
+             nullptr
+            ,0
+            ,details::config_lines_iterator{text}
+            ,details::config_lines_iterator{}
+            ,*pack
+        );
+        details::report_error(emsg, res, *pack, nullptr);
+        if ( !res ) {
+            return false;
+        }
+
+        return publish(emsg, std::move(pack));
+    }
+
+    // the per-thread view of the live_config.
+    // while nothing is published the access is a single atomic load of the version,
+    // the snapshot is re-acquired only after the publication.
+    // the reader holds its snapshot until the next access, or until `release()`.
+    struct reader {
+        explicit reader(const live_config &cfg)
+            :m_cfg{&cfg}
+        { refresh(); }
+
+        const pack_type& get() {
+            if ( m_cfg->version() != m_version ) {
+                refresh();
+            }
+
+            return *m_snapshot;
+        }
+        const pack_type& operator* () { return get(); }
+        const pack_type* operator-> () { return &get(); }
+
+        std::uint64_t version() const noexcept { return m_version; }
+
+        // drops the held snapshot, the next access re-acquires the current one
+        void release() noexcept {
+            m_snapshot.reset();
+            m_version = std::numeric_limits<std::uint64_t>::max();
+        }
+
+    private:
+        void refresh() {
+            // the version is loaded first: if the snapshot is newer than the version,
+            // it's re-acquired once more on the next access
+            m_version = m_cfg->version();
+            m_snapshot = m_cfg->snapshot();
+        }
+
+        const live_config *m_cfg;
+        std::uint64_t m_version{};
+        snapshot_type m_snapshot;
+    };
+
+    reader make_reader() const { return reader{*this}; }
+
+private:
+    pack_type m_proto;
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<snapshot_type> m_current;
+#else
+    snapshot_type m_current;
+#endif
+    std::atomic<std::uint64_t> m_version{};
+};
+
+template<
+     typename ...Args
+    ,typename = typename std::enable_if_t<
+        sizeof...(Args) != 1
+            && !std::is_base_of_v<
+                 kwords_group
+                ,typename std::tuple_element<0, std::tuple<Args...>>::type
+        >
+    >
+>
+auto make_live_config(const Args & ...kwords) {
+    using pack_type = args_pack<details::option_of_t<Args>...>;
+
+    return live_config<pack_type>{kwords...};
+}
+
+template<typename ...Args>
+auto make_live_config(const std::tuple<Args...> &kwords) {
+    using pack_type = args_pack<details::option_of_t<Args>...>;
+
+    return live_config<pack_type>{std::get<Args>(kwords)...};
+}
+
+template<
+     typename KWords
+    ,typename = typename std::enable_if_t<
+        std::is_class_v<KWords> &&
+        std::is_base_of_v<kwords_group, KWords>
+    >
+>
+auto make_live_config(const KWords &kw) {
+    const auto &tuple = details::to_tuple(kw);
+
+    return make_live_config(tuple);
+}
+
 /*************************************************************************************************/
 
 template<typename OS, typename ...Args>
@@ -3022,7 +4906,7 @@ OS& show_help(OS &os, const char *argv0, const args_pack<Args...> &args) {
 
 template<typename OS, typename ...Args>
 OS & show_help(OS &os, const char *argv0, const std::tuple<Args...> &kwords) {
-    args_pack<typename std::decay_t<Args>...> args{std::get<Args>(kwords)...};
+    args_pack<details::option_of_t<Args>...> args{std::get<Args>(kwords)...};
 
     return show_help(os, argv0, args);
 }
@@ -3112,18 +4996,28 @@ bool is_help_or_version_requested(OS &os, const char *argv0, const args_pack<Arg
 /*************************************************************************************************/
 
 #define CMDARGS_OPTION(OPTION_NAME, OPTION_TYPE, OPTION_DESCRIPTION, ...) \
-    const ::cmdargs::option<\
+    const ::cmdargs::option_decl<\
+        struct CMDARGS_CAT(OPTION_NAME, __CMDARGS__OPTION_SUFFIX)\
+        , OPTION_TYPE\
+    > \
+        OPTION_NAME{this, OPTION_DESCRIPTION, std::make_tuple(__VA_ARGS__)}
+
+// the same, but the value is also kept in the atomic cell of the pack,
+// to be read by `args_pack::get_fast()` and tuned by `args_pack::store()`
+#define CMDARGS_ATOMIC_OPTION(OPTION_NAME, OPTION_TYPE, OPTION_DESCRIPTION, ...) \
+    const ::cmdargs::option_decl<\
         struct CMDARGS_CAT(OPTION_NAME, __CMDARGS__OPTION_SUFFIX)\
         , OPTION_TYPE\
+        , true\
     > \
         OPTION_NAME{this, OPTION_DESCRIPTION, std::make_tuple(__VA_ARGS__)}
 
 #define CMDARGS_OPTION_HELP() \
-    const ::cmdargs::details::help_option_type help{this, "show help message" \
+    const ::cmdargs::details::help_option_decl help{this, "show help message" \
         ,std::make_tuple(optional)}
 
 #define CMDARGS_OPTION_VERSION(str) \
-    const ::cmdargs::details::version_option_type version{this, "show version message" \
+    const ::cmdargs::details::version_option_decl version{this, "show version message" \
         ,std::make_tuple(optional, ::cmdargs::details::default_t<std::string>{str})}
 
 /*************************************************************************************************/
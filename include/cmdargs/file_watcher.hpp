@@ -0,0 +1,435 @@
+#pragma once
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2021-2026 niXman (github dot nixman at pm dot me)
+// This file is part of CmdArgs(github.com/niXman/cmdargs) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// the watcher of the config files, for the `live_config` or for the user callbacks.
+// it's kept out of the <cmdargs/cmdargs.hpp>, because it needs <unistd.h> and a thread.
+
+#include <cmdargs/cmdargs.hpp>
+
+#if !defined(__linux__)
+#   error "cmdargs: the file_watcher is implemented for Linux only"
+#endif
+
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+#include <cerrno>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace cmdargs {
+
+namespace details {
+
+// the types of the parser and of the pack of all the options of the group
+template<typename KWords>
+using kwords_parser_t = decltype(::cmdargs::compile(std::declval<const KWords &>()));
+template<typename KWords>
+using kwords_pack_t = typename kwords_parser_t<KWords>::pack_type;
+
+} // namespace details
+
+/*************************************************************************************************/
+// the files are watched by inotify from the single background thread.
+// the directory of the file is watched, so the file replaced by the rename is noticed too.
+// the burst of the events for the file is coalesced: the callback is called once
+// when no more events came for the `delay`.
+// the callbacks are called on the thread of the watcher, so the parse is done off the hot path.
+// the exceptions thrown by the callbacks are caught and reported to the error callback,
+// the same as the directory of the file which is removed and is no longer watched.
+
+struct file_watcher {
+    using callback_type = std::function<void(const std::string &fname)>;
+    using error_callback_type = std::function<void(const std::string &fname, const std::string &emsg)>;
+
+    file_watcher(const file_watcher &) = delete;
+    file_watcher& operator= (const file_watcher &) = delete;
+
+    explicit file_watcher(std::chrono::milliseconds delay = std::chrono::milliseconds{100})
+        :m_delay{delay}
+        ,m_inotify_fd{::inotify_init1(IN_NONBLOCK | IN_CLOEXEC)}
+        ,m_wakeup_fd{::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)}
+    {
+        if ( is_open() ) {
+            m_thread = std::thread{[this] { run(); }};
+        }
+    }
+    ~file_watcher() noexcept {
+        stop();
+        if ( m_inotify_fd != -1 ) {
+            ::close(m_inotify_fd);
+        }
+        if ( m_wakeup_fd != -1 ) {
+            ::close(m_wakeup_fd);
+        }
+    }
+
+    bool is_open() const noexcept { return m_inotify_fd != -1 && m_wakeup_fd != -1; }
+
+    // `callback(fname)` is called when the file is changed,
+    // `on_error(fname, emsg)` is called when the callback throws or the file is no longer watched.
+    // the error is reported into the `emsg` if it's not nullptr, or thrown otherwise.
+    bool watch(
+         std::string *emsg
+        ,const std::string &fname
+        ,callback_type callback
+        ,error_callback_type on_error = {})
+    {
+        const auto pos = fname.rfind('/');
+        std::string dir = (pos == std::string::npos)
+            ? std::string{"."}
+            : (pos == 0) ? std::string{"/"} : fname.substr(0, pos)
+        ;
+        std::string name = (pos == std::string::npos) ? fname : fname.substr(pos + 1);
+
+        const int wd = is_open() ? add_watch(dir) : -1;
+        if ( wd == -1 ) {
+            std::string msg = "can't watch the \"";
+            msg += fname;
+            msg += "\" file: ";
+            msg += std::strerror(is_open() ? errno : EBADF);
+            if ( emsg ) {
+                *emsg = std::move(msg);
+            } else {
+                CMDARGS_THROW(invalid_argument(std::move(msg)));
+            }
+
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_entries.push_back({
+             wd
+            ,std::move(dir)
+            ,fname
+            ,std::move(name)
+            ,std::move(callback)
+            ,std::move(on_error)
+            ,false
+            ,{}
+        });
+
+        return true;
+    }
+
+    // the file is parsed into the new pack of the `cfg`, and the pack is published on success.
+    // `on_reload(ok, emsg)` is called after every reload, and for every error, if it's not empty.
+    template<typename Pack>
+    bool watch(
+         std::string *emsg
+        ,const std::string &fname
+        ,live_config<Pack> &cfg
+        ,std::function<void(bool ok, const std::string &emsg)> on_reload = {})
+    {
+        return watch(
+             emsg
+            ,fname
+            ,[&cfg, on_reload](const std::string &path) {
+                std::string msg;
+                bool ok = false;
+                std::ifstream is{path};
+                if ( is ) {
+                    ok = cfg.reload_from_file(&msg, is);
+                } else {
+                    msg = "can't open the \"" + path + "\" file";
+                }
+                if ( on_reload ) {
+                    on_reload(ok, msg);
+                }
+            }
+            ,[on_reload](const std::string &/*path*/, const std::string &msg) {
+                if ( on_reload ) {
+                    on_reload(false, msg);
+                }
+            }
+        );
+    }
+
+    // the file is parsed into the new pack of the options of the `kw`,
+    // and `on_reload(pack)` is called with the validated pack on success.
+    // `on_error(emsg)` is called for every error, if it's not empty.
+    template<
+         typename KWords
+        ,typename = typename std::enable_if_t<
+            std::is_class_v<KWords> &&
+            std::is_base_of_v<kwords_group, KWords>
+        >
+    >
+    bool watch(
+         std::string *emsg
+        ,const std::string &fname
+        ,const KWords &kw
+        ,std::function<void(details::kwords_pack_t<KWords> &&pack)> on_reload
+        ,std::function<void(const std::string &emsg)> on_error = {})
+    {
+        // the parser is shared by the copies of the callback, and doesn't refer to the `kw`
+        auto parser = std::apply(
+             [](const auto &...kwords) {
+                return std::make_shared<const details::kwords_parser_t<KWords>>(kwords...);
+             }
+            ,details::to_tuple(kw)
+        );
+
+        return watch(
+             emsg
+            ,fname
+            ,[parser = std::move(parser), on_reload = std::move(on_reload), on_error](const std::string &path) {
+                std::string msg;
+                std::ifstream is{path};
+                if ( !is ) {
+                    msg = "can't open the \"" + path + "\" file";
+                } else {
+                    auto pack = parser->make_pack();
+                    from_file(&msg, is, pack);
+                    if ( msg.empty() ) {
+                        on_reload(std::move(pack));
+
+                        return;
+                    }
+                }
+                if ( on_error ) {
+                    on_error(msg);
+                }
+            }
+            ,[on_error](const std::string &/*path*/, const std::string &msg) {
+                if ( on_error ) {
+                    on_error(msg);
+                }
+            }
+        );
+    }
+
+    // stops the thread, the callbacks are not called after that
+    void stop() noexcept {
+        if ( !m_thread.joinable() ) {
+            return;
+        }
+
+        m_stop.store(true, std::memory_order_relaxed);
+        const std::uint64_t one = 1;
+        (void)!::write(m_wakeup_fd, &one, sizeof(one));
+        m_thread.join();
+    }
+
+private:
+    using clock_type = std::chrono::steady_clock;
+
+    struct entry {
+        int wd;
+        std::string dir;
+        std::string fname;
+        std::string name;
+        callback_type callback;
+        error_callback_type on_error;
+        bool pending;
+        clock_type::time_point deadline;
+    };
+
+    struct failure {
+        error_callback_type on_error;
+        std::string fname;
+        std::string emsg;
+    };
+
+    int add_watch(const std::string &dir) noexcept {
+        return ::inotify_add_watch(m_inotify_fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    }
+
+    // the milliseconds to the nearest deadline, or -1
+    int poll_timeout() {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto res = clock_type::time_point::max();
+        for ( const auto &it: m_entries ) {
+            if ( it.pending && it.deadline < res ) {
+                res = it.deadline;
+            }
+        }
+        if ( res == clock_type::time_point::max() ) {
+            return -1;
+        }
+
+        const auto ms = std::chrono::ceil<std::chrono::milliseconds>(res - clock_type::now()).count();
+
+        return ms > 0 ? static_cast<int>(ms) : 0;
+    }
+
+    // every event postpones the callback for the file.
+    // on the overflow of the queue the events are lost, so all the files are considered changed.
+    // the watch of the directory removed or unmounted is re-added, since the directory can be
+    // replaced by the new one, and the files are considered changed. if it can't be re-added,
+    // the error is reported and the files of the directory are no longer watched.
+    void read_events(std::vector<failure> &failures) {
+        alignas(::inotify_event) char buf[4096];
+        for ( ;; ) {
+            const auto len = ::read(m_inotify_fd, buf, sizeof(buf));
+            if ( len <= 0 ) {
+                return;
+            }
+
+            const auto deadline = clock_type::now() + m_delay;
+            std::lock_guard<std::mutex> lock{m_mutex};
+            for ( const char *p = buf; p < buf + len; ) {
+                const auto *ev = reinterpret_cast<const ::inotify_event *>(p);
+                p += sizeof(::inotify_event) + ev->len;
+
+                if ( ev->mask & IN_Q_OVERFLOW ) {
+                    for ( auto &it: m_entries ) {
+                        if ( it.wd != -1 ) {
+                            it.pending = true;
+                            it.deadline = deadline;
+                        }
+                    }
+                    continue;
+                }
+                if ( ev->mask & IN_IGNORED ) {
+                    for ( auto &it: m_entries ) {
+                        if ( it.wd != ev->wd ) {
+                            continue;
+                        }
+
+                        it.wd = add_watch(it.dir);
+                        if ( it.wd != -1 ) {
+                            it.pending = true;
+                            it.deadline = deadline;
+                        } else {
+                            std::string msg = "the \"";
+                            msg += it.fname;
+                            msg += "\" file is no longer watched: ";
+                            msg += std::strerror(errno);
+                            it.pending = false;
+                            failures.push_back({it.on_error, it.fname, std::move(msg)});
+                        }
+                    }
+                    continue;
+                }
+                if ( !ev->len ) {
+                    continue;
+                }
+
+                const std::string_view name{ev->name};
+                for ( auto &it: m_entries ) {
+                    if ( it.wd == ev->wd && it.name == name ) {
+                        it.pending = true;
+                        it.deadline = deadline;
+                    }
+                }
+            }
+        }
+    }
+
+    // the exception thrown by the `f` is reported to the `on_error`,
+    // so it does not terminate the thread of the watcher
+    template<typename F>
+    static void call_guarded(const error_callback_type &on_error, const std::string &fname, F &&f) {
+#if CMDARGS_HAS_EXCEPTIONS
+        try {
+            f();
+        } catch (const std::exception &ex) {
+            report(on_error, fname, ex.what());
+        } catch (...) {
+            report(on_error, fname, "unknown exception");
+        }
+#else
+        (void)on_error;
+        (void)fname;
+        f();
+#endif
+    }
+
+    // the exception thrown by the `on_error` is ignored
+    static void report(const error_callback_type &on_error, const std::string &fname, const char *emsg) noexcept {
+#if CMDARGS_HAS_EXCEPTIONS
+        try {
+            if ( on_error ) {
+                on_error(fname, emsg);
+            }
+        } catch (...) {}
+#else
+        if ( on_error ) {
+            on_error(fname, emsg);
+        }
+#endif
+    }
+
+    // the callbacks are called out of the lock, so they can add the watches
+    void call_expired(std::vector<failure> &failures) {
+        for ( const auto &it: failures ) {
+            report(it.on_error, it.fname, it.emsg.c_str());
+        }
+        failures.clear();
+
+        std::vector<std::tuple<callback_type, error_callback_type, std::string>> expired;
+        {
+            const auto now = clock_type::now();
+            std::lock_guard<std::mutex> lock{m_mutex};
+            for ( auto &it: m_entries ) {
+                if ( it.pending && it.deadline <= now ) {
+                    it.pending = false;
+                    expired.emplace_back(it.callback, it.on_error, it.fname);
+                }
+            }
+        }
+        for ( const auto &it: expired ) {
+            const auto &[callback, on_error, fname] = it;
+            call_guarded(on_error, fname, [&callback, &fname] { callback(fname); });
+        }
+    }
+
+    void run() {
+        std::vector<failure> failures;
+        while ( !m_stop.load(std::memory_order_relaxed) ) {
+            ::pollfd fds[2] = {
+                 {m_inotify_fd, POLLIN, 0}
+                ,{m_wakeup_fd, POLLIN, 0}
+            };
+            const int res = ::poll(fds, 2, poll_timeout());
+            if ( res == -1 && errno != EINTR ) {
+                return;
+            }
+            if ( res > 0 && (fds[0].revents & POLLIN) ) {
+                read_events(failures);
+            }
+            call_expired(failures);
+        }
+    }
+
+    std::chrono::milliseconds m_delay;
+    int m_inotify_fd;
+    int m_wakeup_fd;
+    std::mutex m_mutex;
+    std::vector<entry> m_entries;
+    std::atomic<bool> m_stop{false};
+    std::thread m_thread;
+};
+
+/*************************************************************************************************/
+
+} // ns cmdargs
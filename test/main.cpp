@@ -30,8 +30,14 @@
 
 #include <iostream>
 #include <sstream>
+#include <thread>
+#include <atomic>
 
 #include <cmdargs/cmdargs.hpp>
+#if defined(__linux__)
+#   include <cmdargs/file_watcher.hpp>
+#   include <sys/stat.h>
+#endif
 
 #include <cstdio>
 #include <cstdlib>
@@ -181,6 +187,192 @@ static void test_templates() {
     static_assert(true  == has_relation_not(tuple5));
 }
 
+static void test_names_table() {
+    using namespace cmdargs::details;
+
+    constexpr std::array<std::string_view, 6> names{{
+        "fname", "fsize", "fmode", "f", "fname2", "fname"
+    }};
+    constexpr auto table = make_names_table(names);
+    static_assert(table.find("fname") == 0);
+    static_assert(table.find("fsize") == 1);
+    static_assert(table.find("fmode") == 2);
+    static_assert(table.find("f") == 3);
+    static_assert(table.find("fname2") == 4);
+    static_assert(table.find("fnam") == npos);
+    static_assert(table.find("") == npos);
+    static_assert(table.find("help") == npos);
+
+    constexpr auto empty = make_names_table(std::array<std::string_view, 0>{});
+    static_assert(empty.find("fname") == npos);
+
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(fname, std::string, "source file name");
+        CMDARGS_OPTION(fname2, std::string, "second file name", optional);
+        CMDARGS_OPTION(report, bool, "report", optional);
+    } const kwords;
+
+    {
+        const char * const margv[] = {
+             "cmdargs-test"
+            ,"--fname2=2.txt"
+            ,"--report"
+            ,"--fname=1.txt"
+        };
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords);
+        CMDARGS_ASSERT(emsg.empty());
+        CMDARGS_ASSERT(args[kwords.fname] == "1.txt");
+        CMDARGS_ASSERT(args[kwords.fname2] == "2.txt");
+        CMDARGS_ASSERT(args[kwords.report] == true);
+        CMDARGS_ASSERT(args.is_bool_type("report") == true);
+        CMDARGS_ASSERT(args.is_bool_type("fname") == false);
+        CMDARGS_ASSERT(args.is_bool_type("fname3") == false);
+    }
+    {
+        const char * const margv[] = {
+             "cmdargs-test"
+            ,"--fname=1.txt"
+            ,"--fnam=2.txt"
+        };
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords);
+        CMDARGS_ASSERT(emsg == "there is an extra \"--fnam\" option was specified");
+    }
+}
+
+/*************************************************************************************************/
+
+static void test_inplace_function() {
+    using fn_type = cmdargs::details::inplace_function<bool(std::string &, std::string_view)>;
+
+    fn_type empty;
+    CMDARGS_ASSERT(!empty);
+
+    fn_type ptr = [](std::string &dst, std::string_view str) { dst = str; return true; };
+    CMDARGS_ASSERT(static_cast<bool>(ptr));
+    std::string dst;
+    CMDARGS_ASSERT(ptr(dst, "abc") && dst == "abc");
+
+    // the captured state lives in the inline storage
+    const std::string suffix = ".txt";
+    fn_type stateful = [suffix](std::string &dst, std::string_view str) {
+        dst = str;
+        dst += suffix;
+        return !str.empty();
+    };
+    fn_type copy = stateful;
+    fn_type moved = std::move(stateful);
+    CMDARGS_ASSERT(copy(dst, "1") && dst == "1.txt");
+    CMDARGS_ASSERT(moved(dst, "2") && dst == "2.txt");
+    CMDARGS_ASSERT(!moved(dst, ""));
+
+    copy = ptr;
+    CMDARGS_ASSERT(copy(dst, "3") && dst == "3");
+    copy = std::move(moved);
+    CMDARGS_ASSERT(copy(dst, "4") && dst == "4.txt");
+
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(fname, std::string, "source file name"
+            ,converter_([suffix = std::string{".txt"}](std::string &dst, std::string_view str) {
+                dst = str;
+                dst += suffix;
+                return true;
+            })
+        );
+        CMDARGS_OPTION(fsize, std::size_t, "source file size", optional);
+    } const kwords;
+
+    const char * const margv[] = {
+         "cmdargs-test"
+        ,"--fname=1"
+        ,"--fsize=3"
+    };
+    int margc = sizeof(margv)/sizeof(margv[0]);
+
+    std::string emsg;
+    auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords);
+    CMDARGS_ASSERT(emsg.empty());
+    CMDARGS_ASSERT(args[kwords.fname] == "1.txt");
+    CMDARGS_ASSERT(args[kwords.fsize] == 3);
+}
+
+/*************************************************************************************************/
+
+static void test_convert_fields() {
+    using namespace cmdargs::details;
+
+    for ( std::string_view str: {"", "a", "a,b", "a,b,", ",a", "a,,b", ",", ",,"} ) {
+        std::vector<std::string_view> expected;
+        split(expected, str, ',');
+        CMDARGS_ASSERT(count_fields(str, ',') == expected.size());
+
+        std::vector<std::string> vec;
+        CMDARGS_ASSERT(convert_as_vector(vec, str, ','));
+        CMDARGS_ASSERT(vec.size() == expected.size());
+        CMDARGS_ASSERT(std::equal(vec.begin(), vec.end(), expected.begin()));
+    }
+
+    for ( std::string_view str: {
+         "0", "7", "42", "12345678", "123456789", "00000001", "99999999", "1234567890123456"
+        ,"12345678901234567", "18446744073709551615", "0x1F", "0X10", "12abc", "1 2"
+        ,"0x0", "0xabcdef", "0xABCDEF12", "0x123456789", "0xFFFFFFFFFFFFFFFF", "0x1fFfFfFfFfFfFfFf"
+        ,"0x10000000000000000", "0x1g", "0x:", "0x@", "0xG", "0x`", "0x/", "0x-1", "0x"} )
+    {
+        std::uint64_t expected = 0, res = 0;
+        const bool ok = from_string(&expected, str);
+        CMDARGS_ASSERT(from_string_int(&res, str) == ok);
+        CMDARGS_ASSERT(!ok || res == expected);
+    }
+    for ( std::string_view str: {"0", "-5", "2147483647", "-2147483648", "99999999", "100000000"
+        ,"0x7FFFFFF", "0x7FFFFFFF", "0x80000000", "0x-1"} )
+    {
+        std::int32_t expected = 0, res = 0;
+        const bool ok = from_string(&expected, str);
+        CMDARGS_ASSERT(from_string_int(&res, str) == ok);
+        CMDARGS_ASSERT(!ok || res == expected);
+    }
+    {
+        // long enough to take the vectorized delimiters search
+        std::string str;
+        std::vector<std::uint32_t> expected;
+        for ( std::uint32_t i = 0; i < 1000; ++i ) {
+            const auto v = i * 2654435761u;
+            str += (i % 7 == 0 ? "0x" + std::to_string(v % 0xFFFF) : std::to_string(v));
+            str += ',';
+            expected.push_back(i % 7 == 0 ? static_cast<std::uint32_t>(std::stoul(std::to_string(v % 0xFFFF), nullptr, 16)) : v);
+        }
+        std::vector<std::uint32_t> vec;
+        CMDARGS_ASSERT(convert_as_vector(vec, str, ','));
+        CMDARGS_ASSERT(vec == expected);
+    }
+
+    std::vector<std::size_t> vec;
+    CMDARGS_ASSERT(convert_as_vector(vec, "1,2,3", ','));
+    CMDARGS_ASSERT(vec.capacity() == 3);
+    CMDARGS_ASSERT((vec == std::vector<std::size_t>{1, 2, 3}));
+
+    std::list<std::size_t> list;
+    CMDARGS_ASSERT(convert_as_list(list, "3;2;1", ';'));
+    CMDARGS_ASSERT((list == std::list<std::size_t>{3, 2, 1}));
+
+    std::set<std::string> set;
+    CMDARGS_ASSERT(convert_as_set(set, "c,a,b,a", ','));
+    CMDARGS_ASSERT((set == std::set<std::string>{"a", "b", "c"}));
+
+    std::map<std::string, std::size_t> map;
+    CMDARGS_ASSERT(convert_as_map(map, "b=2,a=1", ',', '='));
+    CMDARGS_ASSERT((map == std::map<std::string, std::size_t>{{"a", 1}, {"b", 2}}));
+    CMDARGS_ASSERT(!convert_as_map(map, "a=1=2", ',', '='));
+    CMDARGS_ASSERT(!convert_as_map(map, "a", ',', '='));
+}
+
+/*************************************************************************************************/
+
 static void test_decl_00() {
     struct: cmdargs::kwords_group {
         CMDARGS_OPTION(fname, std::string, "source file name");
@@ -650,6 +842,64 @@ static void test_cond_and_00() {
 
 /*************************************************************************************************/
 
+static void test_cond_and_01() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(fname, std::string, "source file name", optional);
+        CMDARGS_OPTION(fsize, std::size_t, "source file size", optional);
+        CMDARGS_OPTION(fmode, std::string, "processing mode", optional, and_(fname, fsize));
+    } const kwords;
+
+    {
+        const char * const margv[] = {
+             "cmdargs-test"
+            ,"--fmode=read"
+        };
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords);
+        CMDARGS_ASSERT(emsg == "the \"--fmode\" option must be used together with \"--fname, --fsize\"");
+    }
+    {
+        // the "fsize" option is absent in the pack, so it is never set
+        const char * const margv[] = {
+             "cmdargs-test"
+            ,"--fname=1.txt"
+            ,"--fmode=read"
+        };
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        auto args = cmdargs::parse_args(
+             &emsg
+            ,margc
+            ,cmdargs_mutable_argv(margv)
+            ,kwords.fname
+            ,kwords.fmode
+        );
+        CMDARGS_ASSERT(emsg == "the \"--fmode\" option must be used together with \"--fsize\"");
+    }
+    {
+        const char * const margv[] = {
+             "cmdargs-test"
+            ,"--fname=1.txt"
+        };
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        auto args = cmdargs::parse_args(
+             &emsg
+            ,margc
+            ,cmdargs_mutable_argv(margv)
+            ,kwords.fname
+            ,kwords.fmode
+        );
+        CMDARGS_ASSERT(emsg.empty());
+    }
+}
+
+/*************************************************************************************************/
+
 static void test_cond_or_00() {
     struct: cmdargs::kwords_group {
         CMDARGS_OPTION(fname, std::string, "source file name", optional);
@@ -1099,6 +1349,90 @@ static void test_validator_with_deps_00() {
 
 /*************************************************************************************************/
 
+static void test_validator_with_deps_threads() {
+    struct kwords_type: cmdargs::kwords_group {
+        CMDARGS_OPTION(flag, bool, "flag", optional);
+        CMDARGS_OPTION(s, std::string, "s", optional
+            ,validator_([](std::string_view sv, const auto &f) {
+                return !(f.value_or(false) && sv.empty());
+            }, flag)
+        );
+    };
+
+    // the group is created on this thread, but is used and destroyed on the others
+    auto kwords = std::make_unique<const kwords_type>();
+    std::atomic<std::size_t> failed{0};
+    std::vector<std::thread> threads;
+    for ( std::size_t i = 0; i < 4; ++i ) {
+        threads.emplace_back([&kwords, &failed] {
+            for ( std::size_t j = 0; j < 100; ++j ) {
+                const char * const margv[] = {"cmdargs-test", "--flag=true", "--s="};
+                int margc = sizeof(margv)/sizeof(margv[0]);
+
+                std::string emsg;
+                auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), *kwords);
+                (void)args;
+                if ( emsg != "an invalid value \"\" was received for \"--s\" option" ) {
+                    ++failed;
+                }
+            }
+        });
+    }
+    for ( auto &it: threads ) {
+        it.join();
+    }
+    CMDARGS_ASSERT(failed == 0);
+
+    std::thread{[&kwords] { kwords.reset(); }}.join();
+    CMDARGS_ASSERT(!kwords);
+}
+
+/*************************************************************************************************/
+
+static void test_validator_with_deps_slots() {
+    struct kwords_type: cmdargs::kwords_group {
+        CMDARGS_OPTION(flag, bool, "flag", optional);
+        CMDARGS_OPTION(s, std::string, "s", optional
+            ,validator_([](std::string_view sv, const auto &f) {
+                return !(f.value_or(false) && sv.empty());
+            }, flag)
+        );
+        CMDARGS_OPTION(n, int, "n", optional
+            ,validator_([](std::string_view sv, const auto &f) {
+                return f.value_or(false) || sv != "0";
+            }, flag)
+        );
+    };
+
+    // the groups are destroyed not in the order of the construction,
+    // so the slots of the registry are released and reused
+    std::vector<std::unique_ptr<const kwords_type>> groups;
+    for ( std::size_t i = 0; i < 8; ++i ) {
+        groups.push_back(std::make_unique<const kwords_type>());
+    }
+    for ( std::size_t i = 0; i < groups.size(); i += 2 ) {
+        groups[i].reset();
+        groups[i] = std::make_unique<const kwords_type>();
+    }
+
+    for ( const auto &kwords: groups ) {
+        const char * const margv[] = {"cmdargs-test", "--flag=true", "--s=", "--n=0"};
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), *kwords);
+        CMDARGS_ASSERT(emsg == "an invalid value \"\" was received for \"--s\" option");
+
+        const char * const margv2[] = {"cmdargs-test", "--s=a", "--n=0"};
+        margc = sizeof(margv2)/sizeof(margv2[0]);
+        emsg.clear();
+        auto args2 = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv2), *kwords);
+        CMDARGS_ASSERT(emsg == "an invalid value \"0\" was received for \"--n\" option");
+    }
+}
+
+/*************************************************************************************************/
+
 static void test_converter_with_deps_00() {
     struct: cmdargs::kwords_group {
         CMDARGS_OPTION(scale, std::string, "scale", optional, default_(std::string("1")));
@@ -1142,6 +1476,56 @@ static void test_converter_with_deps_00() {
 
 /*************************************************************************************************/
 
+static void test_converter_with_deps_01() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(a, std::int32_t, "a", optional);
+        CMDARGS_OPTION(b, std::int32_t, "b", optional);
+        CMDARGS_OPTION(neg, bool, "neg", optional);
+        CMDARGS_OPTION(sum, std::int32_t, "sum", optional
+            ,converter_for<std::int32_t>([](std::int32_t &v, std::string_view sv, const auto &a, const auto &b, const auto &neg) {
+                cmdargs::details::from_string_impl(&v, sv);
+                v += a.value_or(0) + b.value_or(0);
+                if ( neg.value_or(false) ) {
+                    v = -v;
+                }
+                return true;
+            }, a, b, neg)
+        );
+    } const kwords;
+
+    {
+        const char * const margv[] = {
+             "cmdargs-test"
+            ,"--a=1"
+            ,"--b=2"
+            ,"--neg"
+            ,"--sum=3"
+        };
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords);
+        CMDARGS_ASSERT(emsg.empty());
+        CMDARGS_ASSERT(args[kwords.sum] == -6);
+    }
+    {
+        // the dependencies are resolved against the pack, not the declaration order
+        const char * const margv[] = {
+             "cmdargs-test"
+            ,"--b=2"
+            ,"--sum=3"
+        };
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords.sum, kwords.neg, kwords.b, kwords.a);
+        CMDARGS_ASSERT(emsg.empty());
+        CMDARGS_ASSERT(args[kwords.sum] == 5);
+    }
+}
+
+/*************************************************************************************************/
+
 static void test_default_value_v2() {
     struct: cmdargs::kwords_group {
         CMDARGS_OPTION(netsrc, std::string, "network source name"
@@ -1263,6 +1647,37 @@ fmode=read
 
 /*************************************************************************************************/
 
+static void test_to_file_01() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(verbose, bool, "verbose mode", optional);
+        CMDARGS_OPTION(quiet, bool, "quiet mode", optional);
+    } const kwords;
+
+    const char * const margv[] = {
+         "cmdargs-test"
+        ,"--verbose"
+        ,"--quiet=false"
+    };
+    int margc = sizeof(margv)/sizeof(margv[0]);
+
+    std::string emsg;
+    auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords);
+    CMDARGS_ASSERT(emsg.empty());
+
+    std::ostringstream os;
+    cmdargs::to_file(os, args);
+
+    static const char *expected =
+R"(# verbose mode
+verbose=true
+# quiet mode
+quiet=false
+)";
+    CMDARGS_ASSERT(os.str() == expected);
+}
+
+/*************************************************************************************************/
+
 static void test_from_file_00() {
     struct: cmdargs::kwords_group {
         CMDARGS_OPTION(netsrc, std::string, "network source name", optional, not_(filesrc));
@@ -1326,54 +1741,457 @@ fmode=read
 
 /*************************************************************************************************/
 
-static void test_show_help_and_version_00() {
+static void test_from_file_01() {
     struct: cmdargs::kwords_group {
-        CMDARGS_OPTION(netsrc, std::string, "network source name", optional, not_(filesrc));
-        CMDARGS_OPTION(filesrc, std::string, "file source size", optional, not_(netsrc));
-        CMDARGS_OPTION(fmode, std::string, "processing mode", or_(netsrc, filesrc));
-    } const kw_top;
-
-    {
-        std::ostringstream os;
-        cmdargs::show_help(os, "/test", kw_top);
+        CMDARGS_OPTION(netsrc, std::string_view, "network source name");
+        CMDARGS_OPTION(fmode, std::string_view, "processing mode", optional);
+    } const kwords;
 
-        static const char *expected =
-R"(test:
---netsrc=* : "network source name" (std::string, optional, not(--filesrc))
---filesrc=*: "file source size" (std::string, optional, not(--netsrc))
---fmode=*  : "processing mode" (std::string, required, or(--netsrc, --filesrc))
-)";
+    auto parse = [&kwords](std::string *emsg) {
+        // the stream and its buffer are destroyed on return
+        std::istringstream is{
+R"(# the source
 
-        auto str = os.str();
-        CMDARGS_ASSERT(str == expected);
-    }
-    {
-        const char * const margv[] = {
-             "cmdargs-test"
-            ,"--filesrc=1.txt"
-            ,"--fmode=read"
+    # the indented comment
+netsrc=192.168.1.106
+fmode=read
+)"
         };
-        int margc = sizeof(margv)/sizeof(margv[0]);
 
-        std::string emsg;
-        auto args = cmdargs::parse_args(
-             &emsg
-            ,margc
-            ,cmdargs_mutable_argv(margv)
-            ,kw_top.filesrc
-            ,kw_top.fmode
-        );
-        static_assert(args.contains(kw_top.filesrc) == true);
-        static_assert(args.contains(kw_top.fmode) == true);
+        return cmdargs::from_file(emsg, is, kwords);
+    };
 
-        std::ostringstream os;
-        cmdargs::show_help(os, "/test", args);
+    std::string emsg;
+    auto args = parse(&emsg);
+    CMDARGS_ASSERT(emsg.empty());
+    CMDARGS_ASSERT(args[kwords.netsrc] == "192.168.1.106");
+    CMDARGS_ASSERT(args[kwords.fmode] == "read");
 
-        static const char *expected =
-R"(test:
---filesrc=*: "file source size" (std::string, optional, not(--netsrc))
---fmode=*  : "processing mode" (std::string, required, or(--netsrc, --filesrc))
-)";
+    const auto view = args.keep_text(std::string{"filesrc=1.txt"});
+    CMDARGS_ASSERT(view == "filesrc=1.txt");
+}
+
+/*************************************************************************************************/
+
+static void write_text_file(const char *fname, const char *text) {
+    std::FILE *file = std::fopen(fname, "wb");
+    CMDARGS_ASSERT(file);
+    std::fputs(text, file);
+    std::fclose(file);
+}
+
+static void test_reload_00() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(port, int, "port", optional, default_<int>(80));
+        CMDARGS_OPTION(root, std::string_view, "root", optional);
+        CMDARGS_OPTION(hosts, std::vector<std::string>, "hosts", optional
+            ,converter_(convert_as_vector<std::string>())
+        );
+        CMDARGS_ATOMIC_OPTION(rate, std::size_t, "rate limit", optional);
+    } const kwords;
+
+    std::string emsg;
+    std::istringstream is0{"root=/a\nhosts=a,b\n"};
+    auto args = cmdargs::from_file(&emsg, is0, kwords);
+    CMDARGS_ASSERT(emsg.empty());
+
+    std::vector<int> ports;
+    std::size_t roots = 0;
+    std::size_t hosts = 0;
+    auto port_sub = kwords.port.subscribe(args, [&ports](const std::optional<int> &v) { ports.push_back(v.value()); });
+    auto root_sub = kwords.root.subscribe(args, [&roots](const auto &) { ++roots; });
+    auto hosts_sub = kwords.hosts.subscribe(args, [&hosts](const auto &) { ++hosts; });
+
+    // the reload of the other pack doesn't call the subscribers of this one
+    {
+        std::istringstream is1{"root=/a\n"};
+        auto other = cmdargs::from_file(&emsg, is1, kwords);
+        std::istringstream is{"port=1\nroot=/c\n"};
+        CMDARGS_ASSERT(cmdargs::reload(&emsg, is, other));
+        CMDARGS_ASSERT(ports.empty() && roots == 0 && hosts == 0);
+        CMDARGS_ASSERT(other.get(kwords.port) == 1);
+    }
+
+    // the default value is the same
+    {
+        std::istringstream is{"port=80\nroot=/a\nhosts=a,b\nrate=1\n"};
+        CMDARGS_ASSERT(cmdargs::reload(&emsg, is, args));
+        CMDARGS_ASSERT(emsg.empty());
+        CMDARGS_ASSERT(ports.empty() && roots == 0 && hosts == 0);
+        CMDARGS_ASSERT(args.is_set(kwords.port));
+        CMDARGS_ASSERT(args.get(kwords.root) == "/a");
+        CMDARGS_ASSERT(args.get_fast(kwords.rate) == 1);
+    }
+    {
+        std::istringstream is{"port=8080\nroot=/a\nhosts=a,c\n"};
+        CMDARGS_ASSERT(cmdargs::reload(&emsg, is, args));
+        CMDARGS_ASSERT(ports == std::vector<int>{8080});
+        CMDARGS_ASSERT(roots == 0 && hosts == 1);
+        CMDARGS_ASSERT((args.get(kwords.hosts) == std::vector<std::string>{"a", "c"}));
+        CMDARGS_ASSERT(!args.is_set(kwords.rate));
+        CMDARGS_ASSERT(args.get_fast(kwords.rate) == 0);
+    }
+    // the failed reload keeps the pack
+    {
+        std::istringstream is{"port=a\nroot=/b\n"};
+        CMDARGS_ASSERT(!cmdargs::reload(&emsg, is, args));
+        CMDARGS_ASSERT(emsg == "can't convert value \"a\" for \"port\" option");
+        CMDARGS_ASSERT(ports.size() == 1 && roots == 0);
+        CMDARGS_ASSERT(args.get(kwords.port) == 8080);
+        CMDARGS_ASSERT(args.get(kwords.root) == "/a");
+        emsg.clear();
+    }
+    // the unset option gets its default value, the cancelled subscription is not called
+    {
+        root_sub.reset();
+        const std::string_view root0 = args.get(kwords.root);
+        std::istringstream is{"root=/b\nhosts=a,c\n"};
+        CMDARGS_ASSERT(cmdargs::reload(&emsg, is, args));
+        CMDARGS_ASSERT((ports == std::vector<int>{8080, 80}));
+        CMDARGS_ASSERT(roots == 0 && hosts == 1);
+        CMDARGS_ASSERT(args.get(kwords.root) == "/b");
+        CMDARGS_ASSERT(!args.is_set(kwords.port));
+        // the value taken before the last reload refers to the kept text
+        CMDARGS_ASSERT(root0 == "/a");
+    }
+    // only the texts of the current and of the previous versions are kept
+    for ( std::size_t i = 0; i < 16; ++i ) {
+        const std::string_view prev = args.get(kwords.root);
+        std::istringstream is{"root=/" + std::to_string(i) + "\n"};
+        CMDARGS_ASSERT(cmdargs::reload(&emsg, is, args));
+        CMDARGS_ASSERT(args.get(kwords.root) == "/" + std::to_string(i));
+        CMDARGS_ASSERT(prev == (i == 0 ? "/b" : "/" + std::to_string(i - 1)));
+        CMDARGS_ASSERT(args.kept_texts() == 2);
+    }
+}
+
+/*************************************************************************************************/
+
+static void test_from_mapped_file_00() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(netsrc, std::string_view, "network source name", optional, not_(filesrc));
+        CMDARGS_OPTION(filesrc, std::string_view, "file source name", optional, not_(netsrc));
+        CMDARGS_OPTION(fmode, std::string, "processing mode", or_(netsrc, filesrc));
+        CMDARGS_OPTION(fsize, std::size_t, "file size", optional);
+    } const kwords;
+
+    static const char *fname = "cmdargs-test-mapped.cfg";
+    {
+        write_text_file(fname,
+R"(# the source
+  netsrc=192.168.1.106
+
+fmode=read  
+fsize=1024)"
+        );
+
+        std::string emsg;
+        auto args = cmdargs::from_mapped_file(&emsg, fname, kwords);
+        CMDARGS_ASSERT(emsg.empty());
+        CMDARGS_ASSERT(args[kwords.netsrc] == "192.168.1.106");
+        CMDARGS_ASSERT(args[kwords.fmode] == "read");
+        CMDARGS_ASSERT(args[kwords.fsize] == 1024);
+        CMDARGS_ASSERT(args.is_set(kwords.filesrc) == false);
+
+        // the moved pack keeps the mapping alive
+        auto moved = std::move(args);
+        CMDARGS_ASSERT(moved[kwords.netsrc] == "192.168.1.106");
+    }
+    {
+        write_text_file(fname,
+R"(netsrc=192.168.1.106
+filesrc=1.txt
+fmode=read
+)"
+        );
+
+        std::string emsg;
+        auto args = cmdargs::from_mapped_file(&emsg, fname, kwords);
+        CMDARGS_ASSERT(emsg == "the \"fmode\" option must be used together with one of \"netsrc\", \"filesrc\"");
+    }
+    {
+        write_text_file(fname, "");
+
+        std::string emsg;
+        auto args = cmdargs::from_mapped_file(&emsg, fname, kwords.netsrc, kwords.fsize);
+        CMDARGS_ASSERT(emsg.empty());
+        CMDARGS_ASSERT(args.is_set(kwords.netsrc) == false);
+    }
+    std::remove(fname);
+    {
+        std::string emsg;
+        auto args = cmdargs::from_mapped_file(&emsg, fname, kwords);
+        CMDARGS_ASSERT(emsg == "can't open \"cmdargs-test-mapped.cfg\" file");
+    }
+}
+
+/*************************************************************************************************/
+
+static void test_live_config_00() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(n, int, "number", optional);
+        CMDARGS_OPTION(s, std::string_view, "the same number as the text", optional);
+    } const kwords;
+
+    auto cfg = cmdargs::make_live_config(kwords);
+    CMDARGS_ASSERT(cfg.version() == 0);
+    CMDARGS_ASSERT(!cfg.snapshot()->is_set(kwords.n));
+
+    std::string emsg;
+    {
+        std::istringstream is{"n=1\ns=1\n"};
+        CMDARGS_ASSERT(cfg.reload_from_file(&emsg, is));
+        CMDARGS_ASSERT(emsg.empty());
+        CMDARGS_ASSERT(cfg.version() == 1);
+    }
+    const auto first = cfg.snapshot();
+    CMDARGS_ASSERT(first->get(kwords.n) == 1);
+    CMDARGS_ASSERT(first->get(kwords.s) == "1");
+
+    // the failed reload keeps the current snapshot
+    {
+        std::istringstream is{"n=a\ns=2\n"};
+        CMDARGS_ASSERT(!cfg.reload_from_file(&emsg, is));
+        CMDARGS_ASSERT(!emsg.empty());
+        CMDARGS_ASSERT(cfg.version() == 1);
+        CMDARGS_ASSERT(cfg.snapshot() == first);
+        emsg.clear();
+    }
+
+    // the held snapshot stays valid after the next publication
+    auto reader = cfg.make_reader();
+    {
+        std::istringstream is{"n=2\ns=2\n"};
+        CMDARGS_ASSERT(cfg.reload_from_file(&emsg, is));
+        CMDARGS_ASSERT(cfg.version() == 2);
+    }
+    CMDARGS_ASSERT(first->get(kwords.s) == "1");
+    CMDARGS_ASSERT(reader->get(kwords.n) == 2);
+    CMDARGS_ASSERT(reader.version() == 2);
+
+    // the readers always see the consistent snapshot
+    std::atomic<bool> stop{false};
+    std::atomic<std::size_t> failed{0};
+    std::vector<std::thread> threads;
+    for ( std::size_t i = 0; i < 4; ++i ) {
+        threads.emplace_back([&cfg, &kwords, &stop, &failed] {
+            auto reader = cfg.make_reader();
+            while ( !stop ) {
+                const auto &args = reader.get();
+                if ( std::to_string(args.get(kwords.n)) != args.get(kwords.s) ) {
+                    ++failed;
+                }
+            }
+        });
+    }
+    for ( int i = 3; i < 1000; ++i ) {
+        const auto text = "n=" + std::to_string(i) + "\ns=" + std::to_string(i) + "\n";
+        std::istringstream is{text};
+        CMDARGS_ASSERT(cfg.reload_from_file(&emsg, is));
+    }
+    stop = true;
+    for ( auto &it: threads ) {
+        it.join();
+    }
+    CMDARGS_ASSERT(failed == 0);
+    CMDARGS_ASSERT(reader->get(kwords.n) == 999);
+
+    // the snapshot is destroyed when the last holder releases it
+    std::weak_ptr<const decltype(cfg)::pack_type> last = cfg.snapshot();
+    reader.release();
+    {
+        std::istringstream is{"n=0\ns=0\n"};
+        CMDARGS_ASSERT(cfg.reload_from_file(&emsg, is));
+    }
+    CMDARGS_ASSERT(last.expired());
+}
+
+/*************************************************************************************************/
+
+#if defined(__linux__)
+static void test_file_watcher_00() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(port, int, "port", optional);
+    } const kwords;
+
+    static const char *fname = "cmdargs-test-watched.cfg";
+    static const char *tmpname = "cmdargs-test-watched.cfg.tmp";
+    write_text_file(fname, "port=1\n");
+
+    auto cfg = cmdargs::make_live_config(kwords);
+    std::atomic<std::size_t> reloads{0};
+    std::atomic<std::size_t> failed{0};
+    const auto wait_for = [&reloads](std::size_t num) {
+        for ( std::size_t i = 0; i < 500 && reloads < num; ++i ) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+        return reloads == num;
+    };
+    {
+        cmdargs::file_watcher watcher{std::chrono::milliseconds{200}};
+        CMDARGS_ASSERT(watcher.is_open());
+
+        std::string emsg;
+        CMDARGS_ASSERT(!watcher.watch(&emsg, "cmdargs-no-such-dir/a.cfg", [](const std::string &) {}));
+        CMDARGS_ASSERT(has_substring(emsg, "can't watch the \"cmdargs-no-such-dir/a.cfg\" file"));
+        emsg.clear();
+
+        CMDARGS_ASSERT(watcher.watch(&emsg, fname, cfg, [&reloads, &failed](bool ok, const std::string &) {
+            failed += !ok;
+            ++reloads;
+        }));
+
+        // the burst of the writes is coalesced into the single reload
+        for ( int i = 2; i < 6; ++i ) {
+            write_text_file(fname, ("port=" + std::to_string(i) + "\n").c_str());
+        }
+        CMDARGS_ASSERT(wait_for(1));
+        CMDARGS_ASSERT(cfg.snapshot()->get(kwords.port) == 5);
+
+        // the file replaced by the rename
+        write_text_file(tmpname, "port=6\n");
+        CMDARGS_ASSERT(std::rename(tmpname, fname) == 0);
+        CMDARGS_ASSERT(wait_for(2));
+        CMDARGS_ASSERT(cfg.snapshot()->get(kwords.port) == 6);
+
+        // the invalid file doesn't replace the snapshot
+        write_text_file(fname, "port=a\n");
+        CMDARGS_ASSERT(wait_for(3));
+        CMDARGS_ASSERT(failed == 1);
+        CMDARGS_ASSERT(cfg.snapshot()->get(kwords.port) == 6);
+    }
+    CMDARGS_ASSERT(cfg.version() == 2);
+
+    std::remove(fname);
+}
+
+static void test_file_watcher_01() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(port, int, "port", optional);
+    } const kwords;
+
+    static const char *dname = "cmdargs-test-watched-dir";
+    static const char *fname = "cmdargs-test-watched-dir/a.cfg";
+    static const char *throwing = "cmdargs-test-watched-dir/b.cfg";
+    CMDARGS_ASSERT(::mkdir(dname, 0700) == 0);
+    write_text_file(fname, "port=1\n");
+
+    std::mutex mutex;
+    std::vector<std::string> errors;
+    std::atomic<int> port{0};
+    std::atomic<std::size_t> reloads{0};
+    const auto add_error = [&mutex, &errors](const std::string &emsg) {
+        std::lock_guard<std::mutex> lock{mutex};
+        errors.push_back(emsg);
+    };
+    const auto error_at = [&mutex, &errors](std::size_t idx) {
+        std::lock_guard<std::mutex> lock{mutex};
+        return errors.at(idx);
+    };
+    const auto wait_for = [&mutex, &errors, &reloads](std::size_t num_reloads, std::size_t num_errors) {
+        for ( std::size_t i = 0; i < 500; ++i ) {
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                if ( reloads == num_reloads && errors.size() == num_errors ) {
+                    return true;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+        return false;
+    };
+    {
+        cmdargs::file_watcher watcher{std::chrono::milliseconds{50}};
+        CMDARGS_ASSERT(watcher.is_open());
+
+        // the validated pack of the group is passed to the callback
+        std::string emsg;
+        CMDARGS_ASSERT(watcher.watch(&emsg, fname, kwords
+            ,[&kwords, &port, &reloads](auto &&args) {
+                port = args.get(kwords.port);
+                ++reloads;
+            }
+            ,add_error
+        ));
+        write_text_file(fname, "port=2\n");
+        CMDARGS_ASSERT(wait_for(1, 0));
+        CMDARGS_ASSERT(port == 2);
+
+        write_text_file(fname, "port=a\n");
+        CMDARGS_ASSERT(wait_for(1, 1));
+        CMDARGS_ASSERT(has_substring(error_at(0), "can't convert value \"a\" for \"port\" option"));
+        CMDARGS_ASSERT(port == 2);
+
+        // the exception of the callback is reported
+        CMDARGS_ASSERT(watcher.watch(&emsg, throwing
+            ,[](const std::string &) { throw std::runtime_error{"the callback failed"}; }
+            ,[&add_error](const std::string &path, const std::string &emsg) { add_error(path + ": " + emsg); }
+        ));
+        write_text_file(throwing, "port=3\n");
+        CMDARGS_ASSERT(wait_for(1, 2));
+        CMDARGS_ASSERT(error_at(1) == "cmdargs-test-watched-dir/b.cfg: the callback failed");
+
+        // the removed directory is reported for every file of it
+        std::remove(fname);
+        std::remove(throwing);
+        CMDARGS_ASSERT(::rmdir(dname) == 0);
+        CMDARGS_ASSERT(wait_for(1, 4));
+        CMDARGS_ASSERT(has_substring(error_at(2), "file is no longer watched"));
+        CMDARGS_ASSERT(has_substring(error_at(3), "file is no longer watched"));
+    }
+}
+#endif // __linux__
+
+/*************************************************************************************************/
+
+static void test_show_help_and_version_00() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(netsrc, std::string, "network source name", optional, not_(filesrc));
+        CMDARGS_OPTION(filesrc, std::string, "file source size", optional, not_(netsrc));
+        CMDARGS_OPTION(fmode, std::string, "processing mode", or_(netsrc, filesrc));
+    } const kw_top;
+
+    {
+        std::ostringstream os;
+        cmdargs::show_help(os, "/test", kw_top);
+
+        static const char *expected =
+R"(test:
+--netsrc=* : "network source name" (std::string, optional, not(--filesrc))
+--filesrc=*: "file source size" (std::string, optional, not(--netsrc))
+--fmode=*  : "processing mode" (std::string, required, or(--netsrc, --filesrc))
+)";
+
+        auto str = os.str();
+        CMDARGS_ASSERT(str == expected);
+    }
+    {
+        const char * const margv[] = {
+             "cmdargs-test"
+            ,"--filesrc=1.txt"
+            ,"--fmode=read"
+        };
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        auto args = cmdargs::parse_args(
+             &emsg
+            ,margc
+            ,cmdargs_mutable_argv(margv)
+            ,kw_top.filesrc
+            ,kw_top.fmode
+        );
+        static_assert(args.contains(kw_top.filesrc) == true);
+        static_assert(args.contains(kw_top.fmode) == true);
+
+        std::ostringstream os;
+        cmdargs::show_help(os, "/test", args);
+
+        static const char *expected =
+R"(test:
+--filesrc=*: "file source size" (std::string, optional, not(--netsrc))
+--fmode=*  : "processing mode" (std::string, required, or(--netsrc, --filesrc))
+)";
 
         CMDARGS_ASSERT(os.str() == expected);
     }
@@ -1879,6 +2697,600 @@ static void test_predefined_converters() {
 
 /*************************************************************************************************/
 
+static void test_option_schema() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(fname, std::string, "source file name", and_(fsize));
+        CMDARGS_OPTION(fsize, std::size_t, "source file size", optional, default_<std::size_t>(7));
+    } const kwords;
+
+    // the pack keeps only the values, the deferred texts and the pointers to the shared schema
+    using fname_type = std::decay_t<decltype(kwords.fname)>::option_type;
+    static_assert(sizeof(fname_type) <= sizeof(const fname_type::schema_type *)
+        + sizeof(fname_type::optional_type) + sizeof(std::string_view) + 2 * sizeof(void *));
+
+    const char * const margv[] = {
+         "cmdargs-test"
+        ,"--fname=1.txt"
+        ,"--fsize=3"
+    };
+    int margc = sizeof(margv)/sizeof(margv[0]);
+
+    std::string emsg;
+    auto args0 = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords);
+    CMDARGS_ASSERT(emsg.empty());
+    auto args1 = cmdargs::make_args(kwords.fname = "2.txt", kwords.fsize);
+
+    const auto &fname0 = std::get<fname_type>(args0());
+    const auto &fname1 = std::get<fname_type>(args1());
+    CMDARGS_ASSERT(fname0.description() == kwords.fname.description());
+    CMDARGS_ASSERT(fname1.description().data() == kwords.fname.description().data());
+    CMDARGS_ASSERT(&fname0.and_list() == &fname1.and_list());
+
+    // the relations refer to the compile-time array of the names
+    using fsize_type = std::decay_t<decltype(kwords.fsize)>;
+    constexpr const auto &fsize_names = cmdargs::details::relation_names_v<fsize_type>;
+    static_assert(fsize_names.size() == 1 && fsize_names[0] == "fsize");
+    CMDARGS_ASSERT(fname0.and_list().begin() == fsize_names.data());
+    CMDARGS_ASSERT(fname0.and_list().size() == 1);
+    CMDARGS_ASSERT(kwords.fsize.and_list().empty());
+    CMDARGS_ASSERT(args0[kwords.fname] == "1.txt");
+    CMDARGS_ASSERT(args1[kwords.fname] == "2.txt");
+    CMDARGS_ASSERT(args0[kwords.fsize] == 3);
+    CMDARGS_ASSERT(args1[kwords.fsize] == 7);
+}
+
+/*************************************************************************************************/
+
+static void test_option_schema_lifetime() {
+    struct kwords_type: cmdargs::kwords_group {
+        CMDARGS_OPTION(fname, std::string, "source file name");
+        CMDARGS_OPTION(fsize, std::size_t, "source file size", optional, default_<std::size_t>(7)
+            ,validator_([](std::string_view str) { return str != "0"; })
+        );
+    };
+    using fname_type = std::decay_t<decltype(kwords_type::fname)>::option_type;
+    using fsize_type = std::decay_t<decltype(kwords_type::fsize)>::option_type;
+
+    const char * const margv[] = {"cmdargs-test", "--fname=1.txt"};
+    int margc = sizeof(margv)/sizeof(margv[0]);
+
+    std::string emsg;
+    auto kwords = std::make_unique<const kwords_type>();
+    const auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), *kwords);
+    CMDARGS_ASSERT(emsg.empty());
+    auto parser = cmdargs::compile(*kwords);
+    auto cfg = cmdargs::make_live_config(*kwords);
+
+    // the pack, the parser and the live_config share the schema, and don't refer to the group
+    kwords.reset();
+    const std::vector<char> reused(sizeof(kwords_type), '\x7f');
+    CMDARGS_ASSERT(reused.size() == sizeof(kwords_type));
+
+    CMDARGS_ASSERT(args.get<fname_type>() == "1.txt");
+    CMDARGS_ASSERT(args.get<fsize_type>() == 7);
+    CMDARGS_ASSERT(std::get<fsize_type>(args()).description() == "source file size");
+
+    auto pack = parser.make_pack();
+    const char * const margv2[] = {"cmdargs-test", "--fname=2.txt", "--fsize=0"};
+    margc = sizeof(margv2)/sizeof(margv2[0]);
+    CMDARGS_ASSERT(!parser.parse(&emsg, margc, cmdargs_mutable_argv(margv2), pack));
+    CMDARGS_ASSERT(emsg == "an invalid value \"0\" was received for \"--fsize\" option");
+    emsg.clear();
+
+    std::istringstream is{"fname=3.txt\nfsize=3\n"};
+    CMDARGS_ASSERT(cfg.reload_from_file(&emsg, is));
+    CMDARGS_ASSERT(cfg.snapshot()->get<fname_type>() == "3.txt");
+    CMDARGS_ASSERT(cfg.snapshot()->get<fsize_type>() == 3);
+}
+
+/*************************************************************************************************/
+
+static void test_parse_env_00() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(fname, std::string_view, "source file name");
+        CMDARGS_OPTION(fsize, std::size_t, "source file size", optional);
+        CMDARGS_OPTION(verbose, bool, "verbose", optional);
+    } const kwords;
+
+    auto parser = cmdargs::compile(kwords);
+    {
+        const char * const envp[] = {
+             "PATH=/bin"
+            ,"APP_FNAME=1.txt"
+            ,"APPX_FSIZE=1"
+            ,"APP_fsize=1024"
+            ,"APP_VERBOSE=true"
+            ,nullptr
+        };
+        auto args = parser.make_pack();
+        const auto res = cmdargs::parse_env("APP_", cmdargs_mutable_argv(envp), args);
+        CMDARGS_ASSERT(res);
+        CMDARGS_ASSERT(args.get(kwords.fname) == "1.txt");
+        CMDARGS_ASSERT(args.get(kwords.fsize) == 1024);
+        CMDARGS_ASSERT(args.get(kwords.verbose) == true);
+    }
+    {
+        const char * const envp[] = {"APP_FNAME=1.txt", "APP_FSIZE=a", nullptr};
+        auto args = parser.make_pack();
+        const auto res = cmdargs::parse_env("APP_", cmdargs_mutable_argv(envp), args);
+        CMDARGS_ASSERT(res.error == cmdargs::e_parse_error::cant_convert);
+        CMDARGS_ASSERT(res.token == 1);
+        CMDARGS_ASSERT(args.error_message(res, nullptr) == "can't convert value \"a\" for \"fsize\" option");
+    }
+    {
+        // the unknown variables with the prefix are skipped by default
+        const char * const envp[] = {"APP_FNAME=1.txt", "APP_FNAMEX=1", "APP_HOME=/home", nullptr};
+        auto args = parser.make_pack();
+        auto res = cmdargs::parse_env("APP_", cmdargs_mutable_argv(envp), args);
+        CMDARGS_ASSERT(res);
+        CMDARGS_ASSERT(args.get(kwords.fname) == "1.txt");
+
+        auto strict = parser.make_pack();
+        res = cmdargs::parse_env("APP_", cmdargs_mutable_argv(envp), strict, cmdargs::e_unknown_env::reject);
+        CMDARGS_ASSERT(res.error == cmdargs::e_parse_error::extra_option);
+        CMDARGS_ASSERT(res.token == 1);
+        CMDARGS_ASSERT(strict.error_message(res, nullptr) == "there is an extra \"APP_FNAMEX\" option was specified");
+    }
+    {
+        const char * const envp[] = {"APP_FSIZE=1", nullptr};
+        auto args = parser.make_pack();
+        const auto res = cmdargs::parse_env("APP_", cmdargs_mutable_argv(envp), args);
+        CMDARGS_ASSERT(res.error == cmdargs::e_parse_error::no_required);
+    }
+#if defined(__unix__)
+    {
+        CMDARGS_ASSERT(::setenv("CMDARGS_TEST_FNAME", "2.txt", 1) == 0);
+        std::string emsg;
+        auto args = cmdargs::parse_env(&emsg, "CMDARGS_TEST_", kwords);
+        CMDARGS_ASSERT(emsg.empty());
+        CMDARGS_ASSERT(args.get(kwords.fname) == "2.txt");
+        CMDARGS_ASSERT(!args.is_set(kwords.fsize));
+        ::unsetenv("CMDARGS_TEST_FNAME");
+    }
+#endif
+}
+
+/*************************************************************************************************/
+
+static void test_compiled_parser_00() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(netsrc, std::string_view, "network source name", optional, not_(filesrc));
+        CMDARGS_OPTION(filesrc, std::string_view, "file source name", optional, not_(netsrc));
+        CMDARGS_OPTION(fmode, std::string_view, "processing mode", or_(netsrc, filesrc));
+        CMDARGS_OPTION(fsize, std::size_t, "file size", optional, default_<std::size_t>(7));
+    } const kwords;
+
+    const auto parser = cmdargs::compile(kwords);
+    auto args = parser.make_pack();
+
+    {
+        const std::string_view tokens[] = {"--netsrc=192.168.1.106", "--fmode=read", "--fsize=1024"};
+
+        std::string emsg;
+        CMDARGS_ASSERT(parser.parse(&emsg, tokens, args));
+        CMDARGS_ASSERT(args[kwords.netsrc] == "192.168.1.106");
+        CMDARGS_ASSERT(args[kwords.fmode] == "read");
+        CMDARGS_ASSERT(args[kwords.fsize] == 1024);
+    }
+    {
+        // the values of the previous parse are reset
+        const std::string_view tokens[] = {"--filesrc=1.txt", "--fmode=write"};
+
+        std::string emsg;
+        CMDARGS_ASSERT(parser.parse(&emsg, tokens, args));
+        CMDARGS_ASSERT(args.is_set(kwords.netsrc) == false);
+        CMDARGS_ASSERT(args[kwords.filesrc] == "1.txt");
+        CMDARGS_ASSERT(args[kwords.fmode] == "write");
+        CMDARGS_ASSERT(args.is_set(kwords.fsize) == false);
+        CMDARGS_ASSERT(args[kwords.fsize] == 7);
+    }
+    {
+        const std::string_view tokens[] = {"--netsrc=192.168.1.106", "--filesrc=1.txt", "--fmode=read"};
+
+        std::string emsg;
+        CMDARGS_ASSERT(!parser.parse(&emsg, tokens, args));
+        CMDARGS_ASSERT(emsg == "the \"--fmode\" option must be used together with one of \"--netsrc\", \"--filesrc\"");
+    }
+    {
+        const char * const margv[] = {
+             "cmdargs-test"
+            ,"--netsrc=192.168.1.106"
+            ,"--fmode=read"
+        };
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        CMDARGS_ASSERT(parser.parse(&emsg, margc, cmdargs_mutable_argv(margv), args));
+        CMDARGS_ASSERT(args[kwords.netsrc] == "192.168.1.106");
+        CMDARGS_ASSERT(args.is_set(kwords.filesrc) == false);
+    }
+    {
+        const auto part = cmdargs::compile(kwords.netsrc, kwords.fsize);
+        auto part_args = part.make_pack();
+        static_assert(part_args.size() == 2);
+
+        const char *tokens[] = {"--netsrc=192.168.1.106"};
+        std::string emsg;
+        CMDARGS_ASSERT(part.parse(&emsg, tokens, part_args));
+        CMDARGS_ASSERT(part_args[kwords.netsrc] == "192.168.1.106");
+    }
+}
+
+/*************************************************************************************************/
+
+static void test_parse_result_00() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(netsrc, std::string_view, "network source name", optional, not_(filesrc));
+        CMDARGS_OPTION(filesrc, std::string_view, "file source name", optional, not_(netsrc));
+        CMDARGS_OPTION(fmode, std::string_view, "processing mode", or_(netsrc, filesrc));
+        CMDARGS_OPTION(fsize, std::size_t, "file size", optional);
+    } const kwords;
+
+    const auto parser = cmdargs::compile(kwords);
+    auto args = parser.make_pack();
+    {
+        const std::string_view tokens[] = {"--netsrc=192.168.1.106", "--fmode=read"};
+        const auto res = parser.parse(tokens, args);
+        CMDARGS_ASSERT(res);
+        CMDARGS_ASSERT(res.error == cmdargs::e_parse_error::ok);
+        CMDARGS_ASSERT(args.error_message(res).empty());
+    }
+    {
+        const std::string_view tokens[] = {"--netsrc=192.168.1.106", "--fsize=wrong", "--fmode=read"};
+        const auto res = parser.parse(tokens, args);
+        CMDARGS_ASSERT(!res);
+        CMDARGS_ASSERT(res.error == cmdargs::e_parse_error::cant_convert);
+        CMDARGS_ASSERT(res.option == 3);
+        CMDARGS_ASSERT(res.token == 1);
+        CMDARGS_ASSERT(res.text == "wrong");
+        CMDARGS_ASSERT(args.error_message(res) == "can't convert value \"wrong\" for \"--fsize\" option");
+    }
+    {
+        const std::string_view tokens[] = {"--fmode=read", "--fname=1.txt"};
+        const auto res = parser.parse(tokens, args);
+        CMDARGS_ASSERT(res.error == cmdargs::e_parse_error::extra_option);
+        CMDARGS_ASSERT(res.option == cmdargs::details::npos);
+        CMDARGS_ASSERT(res.token == 1);
+        CMDARGS_ASSERT(res.text == "fname");
+        CMDARGS_ASSERT(args.error_message(res) == "there is an extra \"--fname\" option was specified");
+    }
+    {
+        const std::string_view tokens[] = {"--fsize"};
+        const auto res = parser.parse(tokens, args);
+        CMDARGS_ASSERT(res.error == cmdargs::e_parse_error::no_value);
+        CMDARGS_ASSERT(res.option == 3);
+        CMDARGS_ASSERT(args.error_message(res) == "a value must be provided for \"--fsize\" option");
+    }
+    {
+        const std::string_view tokens[] = {"--fsize=1"};
+        const auto res = parser.parse(tokens, args);
+        CMDARGS_ASSERT(res.error == cmdargs::e_parse_error::no_required);
+        CMDARGS_ASSERT(res.option == 2);
+        CMDARGS_ASSERT(res.token == cmdargs::details::npos);
+        CMDARGS_ASSERT(args.error_message(res) == "no required \"--fmode\" option was specified");
+    }
+    {
+        const std::string_view tokens[] = {"--netsrc=192.168.1.106", "--filesrc=1.txt", "--fmode=read"};
+        const auto res = parser.parse(tokens, args);
+        CMDARGS_ASSERT(res.error == cmdargs::e_parse_error::cond_or);
+        CMDARGS_ASSERT(res.option == 2);
+        CMDARGS_ASSERT(args.error_message(res) == "the \"--fmode\" option must be used together with one of \"--netsrc\", \"--filesrc\"");
+    }
+    {
+        // the numbers converted by the default converter are reported without exceptions
+        const char * const margv[] = {
+             "cmdargs-test"
+            ,"--fmode=read"
+            ,"--netsrc=192.168.1.106"
+            ,"--fsize=abc"
+        };
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        auto args2 = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords);
+        CMDARGS_ASSERT(emsg == "can't convert value \"abc\" for \"--fsize\" option");
+    }
+}
+
+/*************************************************************************************************/
+
+static void test_lazy_conversion_00() {
+    static std::size_t converted = 0;
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(fname, std::string, "file name");
+        CMDARGS_OPTION(fsize, std::size_t, "file size", optional, lazy
+            ,converter_([](std::size_t &dst, std::string_view str) {
+                ++converted;
+                return cmdargs::details::from_string(&dst, str);
+            })
+        );
+        CMDARGS_OPTION(port, int, "port number", optional);
+    } const kwords;
+
+    {
+        // per option
+        const char * const margv[] = {"cmdargs-test", "--fname=1.txt", "--fsize=1024"};
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        converted = 0;
+        const auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords);
+        CMDARGS_ASSERT(emsg.empty());
+        CMDARGS_ASSERT(converted == 0);
+        CMDARGS_ASSERT(args.is_set(kwords.fsize));
+        CMDARGS_ASSERT(args.get(kwords.fsize) == 1024);
+        CMDARGS_ASSERT(args[kwords.fsize] == 1024);
+        CMDARGS_ASSERT(converted == 1);
+    }
+    {
+        // per pack, the bad value is not reported by the parse
+        const auto parser = cmdargs::compile(kwords);
+        auto args = parser.make_pack();
+        args.set_lazy(true);
+        CMDARGS_ASSERT(args.is_lazy());
+
+        const std::string_view tokens[] = {"--fname=1.txt", "--port=x"};
+        CMDARGS_ASSERT(parser.parse(tokens, args));
+        CMDARGS_ASSERT(args.is_set(kwords.port));
+
+        const auto res = args.materialize_all();
+        CMDARGS_ASSERT(!res);
+        CMDARGS_ASSERT(res.error == cmdargs::e_parse_error::cant_convert);
+        CMDARGS_ASSERT(res.option == 2);
+        CMDARGS_ASSERT(res.text == "x");
+        CMDARGS_ASSERT(args.error_message(res) == "can't convert value \"x\" for \"--port\" option");
+        CMDARGS_ASSERT(args.get(kwords.fname) == "1.txt");
+
+        bool thrown = false;
+        try {
+            (void)args.get(kwords.port);
+        } catch (const std::exception &ex) {
+            thrown = true;
+            CMDARGS_ASSERT(std::string_view{ex.what()} == "can't convert value \"x\" for \"--port\" option");
+        }
+        CMDARGS_ASSERT(thrown);
+
+        // the flag is kept by the reset
+        const std::string_view tokens2[] = {"--fname=2.txt", "--port=80"};
+        CMDARGS_ASSERT(parser.parse(tokens2, args));
+        CMDARGS_ASSERT(args.materialize_all());
+        CMDARGS_ASSERT(args.get(kwords.port) == 80);
+        const auto &[fname, fsize, port] = args.value_refs();
+        CMDARGS_ASSERT(fname == "2.txt" && fsize == 0 && port == 80);
+    }
+}
+
+static void test_lazy_conversion_01() {
+    static std::atomic<std::size_t> converted{0};
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(fsize, std::size_t, "file size", optional, lazy
+            ,converter_([](std::size_t &dst, std::string_view str) {
+                ++converted;
+                return cmdargs::details::from_string(&dst, str);
+            })
+        );
+        CMDARGS_OPTION(limit, std::size_t, "size limit", optional
+            ,validator_([](std::string_view str, const auto &fsize) {
+                std::size_t v{};
+                return cmdargs::details::from_string(&v, str) && fsize.value_or(0) <= v;
+            }, fsize)
+        );
+        CMDARGS_OPTION(port, int, "port number", optional, lazy);
+    } const kwords;
+
+    {
+        // the option the dependency refers to is converted before the validation,
+        // the other deferred options are not
+        const std::string_view tokens[] = {"--fsize=1024", "--port=80", "--limit=2048"};
+        const auto parser = cmdargs::compile(kwords);
+        auto args = parser.make_pack();
+        converted = 0;
+        CMDARGS_ASSERT(parser.parse(tokens, args));
+        CMDARGS_ASSERT(converted == 1);
+        CMDARGS_ASSERT(!std::get<0>(args()).is_deferred());
+        CMDARGS_ASSERT(std::get<2>(args()).is_deferred());
+
+        const std::string_view bad[] = {"--fsize=1024", "--limit=512"};
+        CMDARGS_ASSERT(parser.parse(bad, args).error == cmdargs::e_parse_error::invalid_value);
+    }
+    {
+        // the deferred value of the shared const pack is converted once
+        const char * const margv[] = {"cmdargs-test", "--fsize=1024"};
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        converted = 0;
+        const auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords);
+        CMDARGS_ASSERT(emsg.empty());
+        CMDARGS_ASSERT(converted == 0);
+
+        std::atomic<std::size_t> matched{0};
+        std::vector<std::thread> readers;
+        for ( int i = 0; i < 8; ++i ) {
+            readers.emplace_back([&args, &kwords, &matched] {
+                matched += args.is_set(kwords.fsize) && args.get(kwords.fsize) == 1024;
+            });
+        }
+        for ( auto &it: readers ) {
+            it.join();
+        }
+        CMDARGS_ASSERT(matched == 8);
+        CMDARGS_ASSERT(converted == 1);
+    }
+}
+
+/*************************************************************************************************/
+
+// the group with the literal option types and the captureless validators/converters
+// is constant-initialized
+CMDARGS_CONSTINIT static const struct: cmdargs::kwords_group {
+    CMDARGS_OPTION(fname, std::string_view, "file name");
+    CMDARGS_OPTION(fsize, std::size_t, "file size", optional, default_<std::size_t>(7), and_(fname));
+    CMDARGS_OPTION(port, int, "port number", optional
+        ,validator_([](const std::string_view str) { return str != "0"; })
+        ,converter_([](int &dst, std::string_view str) { return cmdargs::details::from_string(&dst, str); })
+    );
+} constinit_kwords;
+
+static void test_atomic_option_00() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_ATOMIC_OPTION(rate, std::size_t, "rate limit", optional, default_<std::size_t>(100));
+        CMDARGS_ATOMIC_OPTION(ratio, double, "sampling ratio", optional
+            ,validator_([](std::string_view str) { return !str.empty() && str[0] != '-'; })
+        );
+        CMDARGS_OPTION(name, std::string, "name", optional);
+    } const kwords;
+
+    // only the `atomic` options have the cells, so the pack of the scalar options keeps its alignment
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(a, int, "a", optional);
+        CMDARGS_OPTION(b, double, "b", optional);
+    } const scalar_kwords;
+    using atomic_pack_type = decltype(cmdargs::compile(kwords))::pack_type;
+    using scalar_pack_type = decltype(cmdargs::compile(scalar_kwords))::pack_type;
+    static_assert(alignof(atomic_pack_type) == CMDARGS_CACHE_LINE_SIZE);
+    static_assert(alignof(scalar_pack_type) < CMDARGS_CACHE_LINE_SIZE);
+    static_assert(kwords.rate.is_atomic() && !kwords.name.is_atomic() && !scalar_kwords.a.is_atomic());
+
+    {
+        const char * const margv[] = {"cmdargs-test", "--ratio=0.5"};
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords);
+        CMDARGS_ASSERT(emsg.empty());
+        CMDARGS_ASSERT(args.get_fast(kwords.rate) == 100);
+        CMDARGS_ASSERT(args.get_fast(kwords.ratio) == 0.5);
+
+        // the value is validated and converted as by the parse
+        CMDARGS_ASSERT(args.store(kwords.rate, "200"));
+        CMDARGS_ASSERT(args.get_fast(kwords.rate) == 200);
+        CMDARGS_ASSERT(args.get(kwords.rate) == 100);
+
+        const auto res = args.store(kwords.ratio, "-1");
+        CMDARGS_ASSERT(res.error == cmdargs::e_parse_error::invalid_value);
+        CMDARGS_ASSERT(args.error_message(res) == "an invalid value \"-1\" was received for \"--ratio\" option");
+        CMDARGS_ASSERT(args.store(kwords.rate, "a").error == cmdargs::e_parse_error::cant_convert);
+        CMDARGS_ASSERT(args.get_fast(kwords.ratio) == 0.5);
+        CMDARGS_ASSERT(args.get_fast(kwords.rate) == 200);
+
+        // the lazy pack doesn't defer the `atomic` options
+        args.reset();
+        CMDARGS_ASSERT(args.get_fast(kwords.ratio) == 0.0);
+        args.set_lazy(true);
+        const char * const margv2[] = {"cmdargs-test", "--rate=1", "--ratio=0.25"};
+        margc = sizeof(margv2)/sizeof(margv2[0]);
+        auto parser = cmdargs::compile(kwords);
+        CMDARGS_ASSERT(parser.parse(&emsg, margc, cmdargs_mutable_argv(margv2), args));
+        CMDARGS_ASSERT(args.get_fast(kwords.rate) == 1);
+        CMDARGS_ASSERT(args.get_fast(kwords.ratio) == 0.25);
+    }
+    {
+        auto parser = cmdargs::compile(kwords);
+        const auto args = parser.make_pack();
+        std::atomic<bool> stop{false};
+        std::atomic<std::size_t> failed{0};
+        std::thread reader{[&args, &kwords, &stop, &failed] {
+            while ( !stop ) {
+                const auto v = args.get_fast(kwords.rate);
+                if ( v != 100 && v != 1000 ) {
+                    ++failed;
+                }
+            }
+        }};
+        for ( std::size_t i = 0; i < 1000; ++i ) {
+            CMDARGS_ASSERT(args.store(kwords.rate, (i % 2) ? "100" : "1000"));
+        }
+        stop = true;
+        reader.join();
+        CMDARGS_ASSERT(failed == 0);
+    }
+}
+
+/*************************************************************************************************/
+
+static void test_constinit_kwords_00() {
+    const auto &kwords = constinit_kwords;
+    CMDARGS_ASSERT(kwords.fname.is_required());
+    CMDARGS_ASSERT(kwords.fsize.has_default() && kwords.fsize.get_default_value() == 7);
+    CMDARGS_ASSERT(kwords.fsize.and_list().size() == 1 && kwords.fsize.and_list()[0] == "fname");
+    CMDARGS_ASSERT(kwords.port.uses_custom_validator() && kwords.port.uses_custom_converter());
+
+    {
+        const char * const margv[] = {"cmdargs-test", "--fname=1.txt", "--port=80"};
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        const auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords);
+        CMDARGS_ASSERT(emsg.empty());
+        CMDARGS_ASSERT(args.get(kwords.fname) == "1.txt");
+        CMDARGS_ASSERT(args.get(kwords.fsize) == 7);
+        CMDARGS_ASSERT(args.get(kwords.port) == 80);
+    }
+    {
+        const char * const margv[] = {"cmdargs-test", "--fname=1.txt", "--port=0"};
+        int margc = sizeof(margv)/sizeof(margv[0]);
+
+        std::string emsg;
+        const auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords);
+        CMDARGS_ASSERT(emsg == "an invalid value \"0\" was received for \"--port\" option");
+    }
+}
+
+/*************************************************************************************************/
+
+static void test_args_pack_reset_00() {
+    struct: cmdargs::kwords_group {
+        CMDARGS_OPTION(flag, bool, "flag", optional);
+        CMDARGS_OPTION(s, std::string, "s", optional
+            ,validator_([](std::string_view sv, const auto &f) {
+                if ( f.value_or(false) && sv.empty() ) {
+                    return false;
+                }
+                return !sv.empty();
+            }, flag)
+        );
+        CMDARGS_OPTION(fsize, std::size_t, "file size", optional, default_<std::size_t>(7));
+    } const kwords;
+
+    const auto parser = cmdargs::compile(kwords);
+    auto args = parser.make_pack();
+    {
+        const std::string_view tokens[] = {"--flag=true", "--s=hi", "--fsize=1024"};
+
+        std::string emsg;
+        CMDARGS_ASSERT(parser.parse(&emsg, tokens, args));
+        CMDARGS_ASSERT(args[kwords.flag] == true);
+        CMDARGS_ASSERT(args[kwords.s] == "hi");
+        CMDARGS_ASSERT(args[kwords.fsize] == 1024);
+    }
+
+    args.reset();
+    CMDARGS_ASSERT(args.is_set(kwords.flag) == false);
+    CMDARGS_ASSERT(args.is_set(kwords.s) == false);
+    CMDARGS_ASSERT(args.is_set(kwords.fsize) == false);
+    CMDARGS_ASSERT(args[kwords.fsize] == 7);
+
+    {
+        // the validator's dependency is still bound to the pack
+        const std::string_view tokens[] = {"--flag=true", "--s="};
+
+        std::string emsg;
+        CMDARGS_ASSERT(!parser.parse(&emsg, tokens, args));
+        CMDARGS_ASSERT(!emsg.empty());
+    }
+    {
+        const std::string_view tokens[] = {"--s=ok"};
+
+        std::string emsg;
+        CMDARGS_ASSERT(parser.parse(&emsg, tokens, args));
+        CMDARGS_ASSERT(args.is_set(kwords.flag) == false);
+        CMDARGS_ASSERT(args[kwords.s] == "ok");
+    }
+}
+
+/*************************************************************************************************/
+
 static void test_as_optionals() {
     struct kwords: cmdargs::kwords_group {
         CMDARGS_OPTION(netsrc, std::string, "network source name", optional, not_(filesrc));
@@ -1955,6 +3367,59 @@ static void test_as_values() {
 
 /*************************************************************************************************/
 
+static void test_take_values() {
+    struct kwords: cmdargs::kwords_group {
+        CMDARGS_OPTION(netsrc, std::string, "network source name", optional, not_(filesrc));
+        CMDARGS_OPTION(filesrc, std::string, "file source name", optional, not_(netsrc));
+        CMDARGS_OPTION(fsizes, std::vector<std::size_t>, "file sizes", optional
+            ,convert_as_vector<std::size_t>());
+    } const kwords;
+
+    const char * const margv[] = {
+        "cmdargs-test"
+        ,"--netsrc=192.168.1.106"
+        ,"--fsizes=1,2,3"
+    };
+
+    std::string emsg;
+    auto args = cmdargs::parse_args(
+         &emsg
+        ,std::size(margv)
+        ,cmdargs_mutable_argv(margv)
+        ,kwords
+    );
+    CMDARGS_ASSERT(emsg.empty());
+
+    {
+        const auto &[netsrc, filesrc, fsizes] = args.value_refs();
+        static_assert(std::is_same_v<decltype(netsrc), const std::string &>);
+        static_assert(std::is_same_v<decltype(fsizes), const std::vector<std::size_t> &>);
+        CMDARGS_ASSERT(&netsrc == &args.get(kwords.netsrc));
+        CMDARGS_ASSERT(&fsizes == &args.get(kwords.fsizes));
+        CMDARGS_ASSERT(filesrc.empty());
+    }
+
+    const auto *data = args.get(kwords.fsizes).data();
+    auto [netsrc, filesrc, fsizes] = std::move(args).take_values();
+    static_assert(std::is_same_v<decltype(fsizes), std::vector<std::size_t>>);
+    CMDARGS_ASSERT(netsrc == "192.168.1.106");
+    CMDARGS_ASSERT(filesrc.empty());
+    CMDARGS_ASSERT((fsizes == std::vector<std::size_t>{1, 2, 3}));
+    CMDARGS_ASSERT(fsizes.data() == data);
+
+    const auto [onetsrc, ofilesrc, ofsizes] = cmdargs::parse_args(
+         &emsg
+        ,std::size(margv)
+        ,cmdargs_mutable_argv(margv)
+        ,kwords
+    ).take_optionals();
+    CMDARGS_ASSERT(onetsrc.has_value() && onetsrc.value() == "192.168.1.106");
+    CMDARGS_ASSERT(!ofilesrc.has_value());
+    CMDARGS_ASSERT(ofsizes.has_value() && ofsizes.value().size() == 3);
+}
+
+/*************************************************************************************************/
+
 static void test_version() {
     constexpr auto version = CMDARGS_VERSION_HEX;
     constexpr auto major = CMDARGS_VERSION_GET_MAJOR(version);
@@ -2195,6 +3660,10 @@ static void test_max_options() {
 int main(int, char **) {
     TEST(test_templates);
 
+    TEST(test_names_table);
+    TEST(test_inplace_function);
+    TEST(test_convert_fields);
+
     TEST(test_decl_00);
     TEST(test_decl_01);
     TEST(test_decl_02);
@@ -2207,6 +3676,7 @@ int main(int, char **) {
     TEST(test_bool_00);
 
     TEST(test_cond_and_00);
+    TEST(test_cond_and_01);
 
     TEST(test_cond_or_00);
 
@@ -2219,20 +3689,44 @@ int main(int, char **) {
     TEST(test_converter_00);
 
     TEST(test_validator_with_deps_00);
+    TEST(test_validator_with_deps_threads);
+    TEST(test_validator_with_deps_slots);
 
     TEST(test_converter_with_deps_00);
+    TEST(test_converter_with_deps_01);
 
     TEST(test_default_value_v2);
 
     TEST(test_to_file_00);
+    TEST(test_to_file_01);
     TEST(test_from_file_00);
+    TEST(test_from_file_01);
+    TEST(test_reload_00);
+    TEST(test_from_mapped_file_00);
+    TEST(test_live_config_00);
+#if defined(__linux__)
+    TEST(test_file_watcher_00);
+    TEST(test_file_watcher_01);
+#endif
 
     TEST(test_show_help_and_version_00);
 
     TEST(test_predefined_converters);
 
+    TEST(test_option_schema);
+    TEST(test_option_schema_lifetime);
+    TEST(test_parse_env_00);
+    TEST(test_compiled_parser_00);
+    TEST(test_args_pack_reset_00);
+    TEST(test_parse_result_00);
+    TEST(test_lazy_conversion_00);
+    TEST(test_lazy_conversion_01);
+    TEST(test_atomic_option_00);
+    TEST(test_constinit_kwords_00);
+
     TEST(test_as_optionals);
     TEST(test_as_values);
+    TEST(test_take_values);
 
     TEST(test_version);
 
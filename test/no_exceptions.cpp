@@ -0,0 +1,124 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2021-2026 niXman (github dot nixman at pm dot me)
+// This file is part of CmdArgs(github.com/niXman/cmdargs) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// this translation unit is built with -fno-exceptions (-EHs-c- for MSVC),
+// so every code path of the library reached by the `emsg` overloads is checked to compile
+// without the exceptions.
+
+#include <iostream>
+#include <sstream>
+
+#include <cmdargs/cmdargs.hpp>
+#if defined(__linux__)
+#   include <cmdargs/file_watcher.hpp>
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+
+#define CMDARGS_ASSERT(cond) \
+    do { \
+        if (!(cond)) { \
+            std::fprintf(stderr, "%s:%d: assertion failed: %s\n", __FILE__, __LINE__, #cond); \
+            std::abort(); \
+        } \
+    } while (0)
+
+inline char * const *cmdargs_mutable_argv(const char * const *argv) {
+    return const_cast<char * const *>(argv);
+}
+
+/*************************************************************************************************/
+
+struct: cmdargs::kwords_group {
+    CMDARGS_OPTION(flag, bool, "flag", optional);
+    CMDARGS_OPTION(s, std::string, "s", optional
+        ,validator_([](std::string_view sv, const auto &f) {
+            return !(f.value_or(false) && sv.empty());
+        }, flag)
+    );
+    CMDARGS_OPTION(size, std::size_t, "size", optional, lazy);
+    CMDARGS_ATOMIC_OPTION(level, int, "level", optional);
+} const kwords;
+
+static void test_no_exceptions_parse_args() {
+    const char * const margv[] = {
+         "cmdargs-test"
+        ,"--flag=true"
+        ,"--s=hi"
+        ,"--size=1024"
+        ,"--level=3"
+    };
+    int margc = sizeof(margv)/sizeof(margv[0]);
+
+    std::string emsg;
+    auto args = cmdargs::parse_args(&emsg, margc, cmdargs_mutable_argv(margv), kwords);
+    CMDARGS_ASSERT(emsg.empty());
+    CMDARGS_ASSERT(args[kwords.s] == "hi");
+    CMDARGS_ASSERT(args[kwords.size] == 1024);
+    CMDARGS_ASSERT(args.get_fast(kwords.level) == 3);
+
+    const char * const bad_argv[] = {"cmdargs-test", "--flag=true", "--s="};
+    int bad_argc = sizeof(bad_argv)/sizeof(bad_argv[0]);
+    auto bad = cmdargs::parse_args(&emsg, bad_argc, cmdargs_mutable_argv(bad_argv), kwords);
+    (void)bad;
+    CMDARGS_ASSERT(!emsg.empty());
+}
+
+/*************************************************************************************************/
+
+static void test_no_exceptions_from_file() {
+    std::istringstream is{"flag=true\ns=hi\nlevel=a\n"};
+    std::string emsg;
+    auto args = cmdargs::from_file(&emsg, is, kwords);
+    (void)args;
+    CMDARGS_ASSERT(!emsg.empty());
+
+    auto cfg = cmdargs::make_live_config(kwords);
+    std::istringstream good{"flag=true\ns=hi\nsize=1\n"};
+    CMDARGS_ASSERT(cfg.reload_from_file(&emsg, good));
+    CMDARGS_ASSERT(cfg.snapshot()->get(kwords.size) == 1);
+
+    const char * const envp[] = {"APP_S=env", nullptr};
+    auto pack = cmdargs::compile(kwords).make_pack();
+    CMDARGS_ASSERT(cmdargs::parse_env("APP_", cmdargs_mutable_argv(envp), pack));
+    CMDARGS_ASSERT(pack[kwords.s] == "env");
+}
+
+/*************************************************************************************************/
+
+#define TEST(func) \
+    do { \
+        std::cout << "[" << __COUNTER__ << "] test for " #func "..." << std::flush; \
+        (func)(); \
+        std::cout << "passed!" << std::endl; \
+    } while (0)
+
+int main() {
+    TEST(test_no_exceptions_parse_args);
+    TEST(test_no_exceptions_from_file);
+
+    return EXIT_SUCCESS;
+}